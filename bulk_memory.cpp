@@ -0,0 +1,177 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/jni/bulk_memory.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-17
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/jni/bulk_memory.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cstring>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace jni
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+namespace
+{
+
+/*!
+ * Copies memory using non-temporal stores (falls back to memcpy if platform does not support them or size is too small).
+ * As streaming stores are weakly ordered, FinishNonTemporalCopies() must be called afterwards.
+ */
+void CopyNonTemporal(char* dest, const char* src, size_t size)
+{
+#ifdef __SSE2__
+  // align destination to 16 bytes as required by streaming stores
+  size_t head = (16 - (reinterpret_cast<size_t>(dest) & 15)) & 15;
+  if (size < head + 64)
+  {
+    memcpy(dest, src, size);
+    return;
+  }
+  memcpy(dest, src, head);
+  dest += head;
+  src += head;
+  size -= head;
+
+  for (size_t blocks = size / 64; blocks > 0; blocks--)
+  {
+    __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 16));
+    __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 32));
+    __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 48));
+    _mm_stream_si128(reinterpret_cast<__m128i*>(dest), a);
+    _mm_stream_si128(reinterpret_cast<__m128i*>(dest + 16), b);
+    _mm_stream_si128(reinterpret_cast<__m128i*>(dest + 32), c);
+    _mm_stream_si128(reinterpret_cast<__m128i*>(dest + 48), d);
+    dest += 64;
+    src += 64;
+  }
+  memcpy(dest, src, size % 64);
+#else
+  memcpy(dest, src, size);
+#endif
+}
+
+/*! Makes preceding non-temporal stores visible to other threads (streaming stores are weakly ordered) */
+inline void FinishNonTemporalCopies()
+{
+#ifdef __SSE2__
+  _mm_sfence();
+#endif
+}
+
+}
+
+void CopyMemory(void* dest, const void* src, size_t size)
+{
+  if (size >= cNON_TEMPORAL_COPY_THRESHOLD)
+  {
+    CopyNonTemporal(static_cast<char*>(dest), static_cast<const char*>(src), size);
+    FinishNonTemporalCopies();
+  }
+  else
+  {
+    memcpy(dest, src, size);
+  }
+}
+
+void CopyMemory2D(void* dest, size_t dest_stride, const void* src, size_t src_stride, size_t row_size, size_t rows)
+{
+  assert(row_size <= dest_stride && row_size <= src_stride && "Rows must not overlap");
+  if (rows == 0)
+  {
+    return;
+  }
+  if (dest_stride == row_size && src_stride == row_size)
+  {
+    CopyMemory(dest, src, row_size * rows);
+    return;
+  }
+
+  char* dest_row = static_cast<char*>(dest);
+  const char* src_row = static_cast<const char*>(src);
+  if (row_size * rows >= cNON_TEMPORAL_COPY_THRESHOLD) // whole area is relevant for cache pollution - not the single row
+  {
+    for (size_t i = 0; i < rows; i++)
+    {
+      CopyNonTemporal(dest_row, src_row, row_size);
+      dest_row += dest_stride;
+      src_row += src_stride;
+    }
+    FinishNonTemporalCopies();
+  }
+  else
+  {
+    for (size_t i = 0; i < rows; i++)
+    {
+      memcpy(dest_row, src_row, row_size);
+      dest_row += dest_stride;
+      src_row += src_stride;
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
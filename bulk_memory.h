@@ -0,0 +1,94 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/jni/bulk_memory.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-17
+ *
+ * Bulk memory operations on native memory (used by JNICalls natives).
+ * Large copies bypass the cache in order to not evict the working set of other threads.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__jni__bulk_memory_h__
+#define __rrlib__jni__bulk_memory_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cstddef>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace jni
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+/*! Number of bytes from which on copies use non-temporal stores (if supported by platform) */
+const size_t cNON_TEMPORAL_COPY_THRESHOLD = 4 * 1024 * 1024;
+
+//----------------------------------------------------------------------
+// Function declarations
+//----------------------------------------------------------------------
+
+/*!
+ * Copies memory (like memcpy - areas must not overlap).
+ * Copies with at least cNON_TEMPORAL_COPY_THRESHOLD bytes use non-temporal stores.
+ *
+ * \param dest Destination address
+ * \param src Source address
+ * \param size Number of bytes to copy
+ */
+void CopyMemory(void* dest, const void* src, size_t size);
+
+/*!
+ * Copies rectangular area of memory - e.g. rows of an image (areas must not overlap).
+ * If the area has at least cNON_TEMPORAL_COPY_THRESHOLD bytes, rows are copied with non-temporal stores.
+ *
+ * \param dest Destination address of first row
+ * \param dest_stride Offset between two rows in destination (in bytes)
+ * \param src Source address of first row
+ * \param src_stride Offset between two rows in source (in bytes)
+ * \param row_size Number of bytes to copy per row
+ * \param rows Number of rows to copy
+ */
+void CopyMemory2D(void* dest, size_t dest_stride, const void* src, size_t src_stride, size_t row_size, size_t rows);
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
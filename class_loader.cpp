@@ -0,0 +1,272 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/jni/class_loader.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-17
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/jni/class_loader.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/thread/tLock.h"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <string>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace jni
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+/*! Number of buckets (lists) in class cache */
+static const size_t cCLASS_CACHE_BUCKET_COUNT = 256;
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+namespace
+{
+
+/*! Global reference to application class loader */
+std::atomic<jobject> class_loader(NULL);
+
+/*! ClassLoader.loadClass(String) */
+std::atomic<jmethodID> load_class_method(NULL);
+
+/*!
+ * Entry in class cache.
+ * Entries are never deleted (so that lookups do not need any locks) - there is one per class name.
+ */
+struct tClassCacheEntry
+{
+  /*! Hash of class name */
+  const size_t hash;
+
+  /*! Fully-qualified name of class */
+  const std::string name;
+
+  /*! Global reference to class - NULL if not resolved (anymore) */
+  std::atomic<jclass> clazz;
+
+  /*! Next entry in same bucket */
+  tClassCacheEntry* const next;
+
+  tClassCacheEntry(size_t hash, const char* name, tClassCacheEntry* next) :
+    hash(hash),
+    name(name),
+    clazz(NULL),
+    next(next)
+  {}
+};
+
+/*! Class cache: buckets with append-only lists of entries */
+std::atomic<tClassCacheEntry*> class_cache[cCLASS_CACHE_BUCKET_COUNT];
+
+/*! Mutex for adding entries to class cache */
+rrlib::thread::tMutex class_cache_mutex;
+
+/*! \return Hash of class name (FNV-1a) */
+inline size_t HashClassName(const char* name)
+{
+  size_t hash = 14695981039346656037ULL;
+  for (; *name; name++)
+  {
+    hash = (hash ^ static_cast<unsigned char>(*name)) * 1099511628211ULL;
+  }
+  return hash;
+}
+
+/*! \return Class cache entry with specified name in specified bucket (NULL if there is none) */
+inline tClassCacheEntry* LookupEntry(const std::atomic<tClassCacheEntry*>& bucket, size_t hash, const char* name)
+{
+  for (tClassCacheEntry* entry = bucket.load(std::memory_order_acquire); entry; entry = entry->next)
+  {
+    if (entry->hash == hash && strcmp(entry->name.c_str(), name) == 0)
+    {
+      return entry;
+    }
+  }
+  return NULL;
+}
+
+/*! \return Class resolved without cache (local reference) */
+jclass LoadClass(JNIEnv* env, const std::string& name)
+{
+  jobject loader = class_loader.load(std::memory_order_acquire);
+  if (loader == NULL || name[0] == '[')
+  {
+    return env->FindClass(name.c_str());
+  }
+
+  std::string binary_name(name);
+  std::replace(binary_name.begin(), binary_name.end(), '/', '.');
+  jstring java_name = env->NewStringUTF(binary_name.c_str());
+  if (java_name == NULL)
+  {
+    return NULL;
+  }
+  jclass result = static_cast<jclass>(env->CallObjectMethod(loader, load_class_method.load(std::memory_order_relaxed), java_name));
+  env->DeleteLocalRef(java_name);
+  return env->ExceptionCheck() ? NULL : result;
+}
+
+}
+
+namespace internal
+{
+
+void SetClassLoader(JNIEnv* env, jclass reference_class)
+{
+  if (class_loader.load(std::memory_order_acquire) != NULL)
+  {
+    return;
+  }
+
+  jclass class_class = env->GetObjectClass(reference_class);
+  jmethodID get_class_loader = env->GetMethodID(class_class, "getClassLoader", "()Ljava/lang/ClassLoader;");
+  env->DeleteLocalRef(class_class);
+  jclass class_loader_class = env->FindClass("java/lang/ClassLoader");
+  jmethodID load_class = class_loader_class ? env->GetMethodID(class_loader_class, "loadClass", "(Ljava/lang/String;)Ljava/lang/Class;") : NULL;
+  if (class_loader_class)
+  {
+    env->DeleteLocalRef(class_loader_class);
+  }
+  jobject loader = (get_class_loader && load_class) ? env->CallObjectMethod(reference_class, get_class_loader) : NULL;
+  if (env->ExceptionCheck())
+  {
+    env->ExceptionClear();
+    return;
+  }
+  if (loader == NULL)
+  {
+    return; // loaded by bootstrap class loader - JNIEnv::FindClass works
+  }
+
+  load_class_method.store(load_class, std::memory_order_relaxed);
+  jobject global_loader = env->NewGlobalRef(loader);
+  env->DeleteLocalRef(loader);
+  jobject expected = NULL;
+  if (!class_loader.compare_exchange_strong(expected, global_loader, std::memory_order_acq_rel))
+  {
+    env->DeleteGlobalRef(global_loader); // other thread was faster
+  }
+}
+
+void ClearClassCache(JNIEnv* env)
+{
+  rrlib::thread::tLock l(class_cache_mutex);
+  for (std::atomic<tClassCacheEntry*>& bucket : class_cache)
+  {
+    for (tClassCacheEntry* entry = bucket.load(std::memory_order_acquire); entry; entry = entry->next)
+    {
+      jclass global_class = entry->clazz.exchange(NULL);
+      if (global_class != NULL)
+      {
+        env->DeleteGlobalRef(global_class);
+      }
+    }
+  }
+  jobject loader = class_loader.exchange(NULL);
+  if (loader != NULL)
+  {
+    env->DeleteGlobalRef(loader);
+  }
+}
+
+}
+
+jclass FindClass(const char* name, JNIEnv* env)
+{
+  size_t hash = HashClassName(name);
+  std::atomic<tClassCacheEntry*>& bucket = class_cache[hash % cCLASS_CACHE_BUCKET_COUNT];
+  tClassCacheEntry* entry = LookupEntry(bucket, hash, name);
+  jclass cached_class = entry ? entry->clazz.load(std::memory_order_acquire) : NULL;
+  if (cached_class != NULL)
+  {
+    return cached_class;
+  }
+
+  jclass local_class = LoadClass(env, name);
+  if (local_class == NULL)
+  {
+    return NULL;
+  }
+  jclass global_class = static_cast<jclass>(env->NewGlobalRef(local_class));
+  env->DeleteLocalRef(local_class);
+
+  rrlib::thread::tLock l(class_cache_mutex);
+  entry = LookupEntry(bucket, hash, name);
+  if (entry == NULL)
+  {
+    entry = new tClassCacheEntry(hash, name, bucket.load(std::memory_order_relaxed));
+    bucket.store(entry, std::memory_order_release);
+  }
+  jclass expected = NULL;
+  if (!entry->clazz.compare_exchange_strong(expected, global_class, std::memory_order_acq_rel))
+  {
+    env->DeleteGlobalRef(global_class); // other thread was faster
+    return expected;
+  }
+  return global_class;
+}
+
+jobject GetClassLoader()
+{
+  return class_loader.load(std::memory_order_acquire);
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
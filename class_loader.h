@@ -0,0 +1,105 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/jni/class_loader.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-17
+ *
+ * Class lookup via the application class loader.
+ *
+ * JNIEnv::FindClass resolves classes with the class loader associated with
+ * the calling Java method - on threads attached by native code, this is the
+ * system class loader. Therefore, classes loaded by other class loaders
+ * (e.g. plugins) are not found and lookups are slow.
+ *
+ * The class loader of org.rrlib.jni.JNICalls is captured when the library
+ * is loaded (JNI_OnLoad) or the Java VM is obtained (JNICalls.getJavaVM).
+ * FindClass() uses it - and caches resolved classes - so that lookups
+ * from any thread are a hash lookup after the first call.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__jni__class_loader_h__
+#define __rrlib__jni__class_loader_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/jni/jvm.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace jni
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+namespace internal
+{
+
+/*!
+ * Captures class loader of specified class as application class loader
+ * (only the first successful call has an effect)
+ */
+void SetClassLoader(JNIEnv* env, jclass reference_class);
+
+/*! Deletes cached classes and class loader (called when library is unloaded) */
+void ClearClassCache(JNIEnv* env);
+
+}
+
+//----------------------------------------------------------------------
+// Function declarations
+//----------------------------------------------------------------------
+
+/*!
+ * Looks up Java class - using the application class loader if it has been captured
+ * (and JNIEnv::FindClass otherwise, as well as for array classes).
+ * Resolved classes are cached - lookups of cached classes do not lock or allocate.
+ *
+ * \param name Fully-qualified name of Java class (e.g. "org/rrlib/jni/JNICalls")
+ * \param env JNIEnv of current thread
+ * \return Global reference to Java class - owned by cache (must not be deleted). NULL if class could not be found - then, an exception is pending.
+ */
+jclass FindClass(const char* name, JNIEnv* env = GetEnv());
+
+/*! \return Global reference to captured application class loader (NULL if none has been captured) */
+jobject GetClassLoader();
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
@@ -0,0 +1,202 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/jni/deferred_deletion.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-17
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/jni/deferred_deletion.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/thread/tConditionVariable.h"
+#include "rrlib/thread/tLock.h"
+#include "rrlib/thread/tThread.h"
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace jni
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+namespace
+{
+
+/*! Queue with objects to delete - processed by background thread (which blocks while queue is empty) */
+class tDeletionQueue : public rrlib::thread::tThread
+{
+public:
+
+  tDeletionQueue() :
+    tThread("JNI Deferred Deletion"),
+    mutex(),
+    wakeup(mutex),
+    batch_done(mutex),
+    attached(false),
+    pending(),
+    enqueued_count(0),
+    processed_count(0)
+  {
+    Start();
+    rrlib::thread::tLock l(mutex);
+    while (!attached)
+    {
+      batch_done.Wait(l);
+    }
+  }
+
+  void Enqueue(tJNIWrappable* const* objects, size_t count)
+  {
+    rrlib::thread::tLock l(mutex);
+    bool was_empty = pending.empty();
+    pending.insert(pending.end(), objects, objects + count);
+    enqueued_count += count;
+    if (was_empty)
+    {
+      wakeup.Notify(l);
+    }
+  }
+
+  void Flush()
+  {
+    rrlib::thread::tLock l(mutex);
+    uint64_t target = enqueued_count;
+    while (processed_count < target)
+    {
+      batch_done.Wait(l);
+    }
+  }
+
+  virtual void Run() override
+  {
+    // attach as daemon: this thread never terminates and must not delay Java VM shutdown
+    internal::AttachThread(true);
+
+    {
+      rrlib::thread::tLock l(mutex);
+      attached = true;
+      batch_done.NotifyAll(l);
+    }
+
+    std::vector<tJNIWrappable*> batch;
+    while (!IsStopSignalSet())
+    {
+      {
+        rrlib::thread::tLock l(mutex);
+        if (!batch.empty())
+        {
+          processed_count += batch.size();
+          batch.clear();
+          batch_done.NotifyAll(l);
+        }
+        while (pending.empty())
+        {
+          wakeup.Wait(l);
+        }
+        batch.swap(pending);
+      }
+      for (tJNIWrappable * object : batch)
+      {
+        if (object != NULL)
+        {
+          object->SetJavaWrapper(NULL, false); // avoids that Java "destructor" is invoked (again)
+          delete object;
+        }
+      }
+    }
+  }
+
+private:
+
+  rrlib::thread::tMutex mutex;
+
+  /*! Signalled when objects are enqueued into empty queue */
+  rrlib::thread::tConditionVariable wakeup;
+
+  /*! Signalled when background thread is attached and after each deleted batch */
+  rrlib::thread::tConditionVariable batch_done;
+
+  /*! Whether background thread is attached to Java VM */
+  bool attached;
+
+  /*! Objects waiting for deletion */
+  std::vector<tJNIWrappable*> pending;
+
+  /*! Number of objects enqueued / deleted so far */
+  uint64_t enqueued_count, processed_count;
+};
+
+tDeletionQueue& GetDeletionQueue()
+{
+  static tDeletionQueue* queue = new tDeletionQueue(); // never deleted: background thread runs until process terminates
+  return *queue;
+}
+
+}
+
+void DeleteDeferred(tJNIWrappable* const* objects, size_t count)
+{
+  GetDeletionQueue().Enqueue(objects, count);
+}
+
+void FlushDeferredDeletions()
+{
+  GetDeletionQueue().Flush();
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
@@ -0,0 +1,91 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/jni/deferred_deletion.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-17
+ *
+ * Deferred deletion of tJNIWrappable objects.
+ *
+ * Objects are enqueued and deleted by a background thread - so that
+ * (Java cleanup) threads do not block on C++ destructors.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__jni__deferred_deletion_h__
+#define __rrlib__jni__deferred_deletion_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cstddef>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/jni/tJNIWrappable.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace jni
+{
+
+//----------------------------------------------------------------------
+// Function declarations
+//----------------------------------------------------------------------
+
+/*!
+ * Enqueues objects for deletion by background thread (which is started on first call).
+ * Before deletion, the Java wrapper of each object is reset (as in JNICalls.deleteJNIWrappable).
+ *
+ * \param objects Objects to delete (NULL entries are ignored)
+ * \param count Number of objects
+ */
+void DeleteDeferred(tJNIWrappable* const* objects, size_t count);
+
+/*!
+ * Enqueues object for deletion by background thread (which is started on first call)
+ *
+ * \param object Object to delete
+ */
+inline void DeleteDeferred(tJNIWrappable* object)
+{
+  DeleteDeferred(&object, 1);
+}
+
+/*!
+ * Blocks until all objects enqueued before this call have been deleted
+ */
+void FlushDeferredDeletions();
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
@@ -0,0 +1,274 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/jni/deferred_release.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-17
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/jni/deferred_release.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/thread/tConditionVariable.h"
+#include "rrlib/thread/tLock.h"
+#include "rrlib/thread/tThread.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/jni/instrumentation.h"
+#include "rrlib/jni/tBoundedQueue.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace jni
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+/*! Capacity of queue with references to release */
+static const size_t cRELEASE_QUEUE_CAPACITY = 65536;
+
+/*! Maximum number of references released by background thread in one batch */
+static const size_t cRELEASE_BATCH_SIZE = 256;
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+namespace internal
+{
+std::atomic<bool> deferred_release_enabled(false);
+}
+
+namespace
+{
+
+/*!
+ * Queue with references to release - processed by background thread.
+ * Enqueueing is lock-free. Only if the background thread is waiting for an empty queue,
+ * the producer takes the mutex to wake it up.
+ */
+class tReleaseQueue : public rrlib::thread::tThread
+{
+public:
+
+  tReleaseQueue() :
+    tThread("JNI Reference Release"),
+    queue(cRELEASE_QUEUE_CAPACITY),
+    mutex(),
+    wakeup(mutex),
+    batch_done(mutex),
+    attached(false),
+    sleeping(false),
+    enqueued_count(0),
+    released_count(0),
+    overflow_count(0)
+  {
+    Start();
+    rrlib::thread::tLock l(mutex);
+    while (!attached)
+    {
+      batch_done.Wait(l);
+    }
+  }
+
+  bool Enqueue(jobject reference)
+  {
+    if (!queue.TryEnqueue(reference))
+    {
+      overflow_count.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    enqueued_count.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst); // pairs with fence in Run(): either this thread sees 'sleeping' or Run() sees the reference
+    if (sleeping.load(std::memory_order_relaxed))
+    {
+      rrlib::thread::tLock l(mutex);
+      wakeup.Notify(l);
+    }
+    return true;
+  }
+
+  void Flush()
+  {
+    uint64_t target = enqueued_count.load(std::memory_order_relaxed);
+    rrlib::thread::tLock l(mutex);
+    while (released_count.load(std::memory_order_acquire) < target)
+    {
+      batch_done.Wait(l);
+    }
+  }
+
+  uint64_t GetOverflowCount() const
+  {
+    return overflow_count.load(std::memory_order_relaxed);
+  }
+
+  virtual void Run() override
+  {
+    JNIEnv* env = internal::AttachThread(true);
+    {
+      rrlib::thread::tLock l(mutex);
+      attached = true;
+      batch_done.NotifyAll(l);
+    }
+
+    jobject batch[cRELEASE_BATCH_SIZE];
+    while (!IsStopSignalSet())
+    {
+      size_t count = 0;
+      while (count < cRELEASE_BATCH_SIZE && queue.TryDequeue(batch[count]))
+      {
+        count++;
+      }
+      if (count == 0)
+      {
+        rrlib::thread::tLock l(mutex);
+        sleeping.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (queue.GetSize() == 0)
+        {
+          wakeup.Wait(l);
+        }
+        sleeping.store(false, std::memory_order_relaxed);
+        continue;
+      }
+
+      for (size_t i = 0; i < count; i++)
+      {
+        if (env->GetObjectRefType(batch[i]) == JNIWeakGlobalRefType)
+        {
+          env->DeleteWeakGlobalRef(batch[i]);
+          RRLIB_JNI_COUNT(WEAK_GLOBAL_REF_DELETED);
+        }
+        else
+        {
+          env->DeleteGlobalRef(batch[i]);
+          RRLIB_JNI_COUNT(GLOBAL_REF_DELETED);
+        }
+      }
+      rrlib::thread::tLock l(mutex);
+      released_count.fetch_add(count, std::memory_order_release);
+      batch_done.NotifyAll(l);
+    }
+  }
+
+private:
+
+  /*! References waiting for release */
+  tBoundedQueue<jobject> queue;
+
+  rrlib::thread::tMutex mutex;
+
+  /*! Signalled when a reference is enqueued while background thread is waiting */
+  rrlib::thread::tConditionVariable wakeup;
+
+  /*! Signalled when background thread is attached and after each released batch */
+  rrlib::thread::tConditionVariable batch_done;
+
+  /*! Whether background thread is attached to Java VM */
+  bool attached;
+
+  /*! Whether background thread is waiting (or about to wait) for references */
+  std::atomic<bool> sleeping;
+
+  /*! Number of references enqueued / released so far */
+  std::atomic<uint64_t> enqueued_count, released_count;
+
+  /*! Number of references that could not be enqueued */
+  std::atomic<uint64_t> overflow_count;
+};
+
+std::atomic<tReleaseQueue*> release_queue(NULL);
+
+/*! Mutex for creating release queue */
+rrlib::thread::tMutex release_queue_mutex;
+
+}
+
+namespace internal
+{
+
+bool EnqueueReferenceRelease(jobject reference)
+{
+  tReleaseQueue* queue = release_queue.load(std::memory_order_acquire);
+  return queue != NULL && queue->Enqueue(reference);
+}
+
+}
+
+void SetDeferredReferenceRelease(bool enabled)
+{
+  if (enabled && release_queue.load(std::memory_order_acquire) == NULL)
+  {
+    rrlib::thread::tLock l(release_queue_mutex);
+    if (release_queue.load(std::memory_order_relaxed) == NULL)
+    {
+      release_queue.store(new tReleaseQueue(), std::memory_order_release); // never deleted: background thread runs until process terminates
+    }
+  }
+  internal::deferred_release_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+void FlushDeferredReferenceReleases()
+{
+  tReleaseQueue* queue = release_queue.load(std::memory_order_acquire);
+  if (queue != NULL)
+  {
+    queue->Flush();
+  }
+}
+
+uint64_t GetReferenceReleaseQueueOverflowCount()
+{
+  tReleaseQueue* queue = release_queue.load(std::memory_order_acquire);
+  return queue != NULL ? queue->GetOverflowCount() : 0;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
@@ -0,0 +1,119 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/jni/deferred_release.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-17
+ *
+ * Deferred release of JNI global references.
+ *
+ * If enabled, tJavaObjectReference does not delete global references
+ * itself, but pushes them onto a lock-free queue. A single background
+ * thread - attached to the Java VM before deferred release is enabled -
+ * deletes them in batches. Thus, destroying wrapped objects on
+ * (real-time) threads never attaches these threads or calls into the
+ * Java VM. If the queue is full, references are deleted immediately.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__jni__deferred_release_h__
+#define __rrlib__jni__deferred_release_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <atomic>
+#include <stdint.h>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/jni/jvm.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace jni
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+namespace internal
+{
+
+/*! Whether deferred release is enabled */
+extern std::atomic<bool> deferred_release_enabled;
+
+/*! Enqueues global or weak global reference for release by background thread. \return False if queue is full */
+bool EnqueueReferenceRelease(jobject reference);
+
+/*!
+ * Releases global or weak global reference via background thread - if deferred release is enabled
+ *
+ * \param reference Reference to release
+ * \return True if reference was enqueued (false if caller needs to delete reference itself)
+ */
+inline bool ReleaseDeferred(jobject reference)
+{
+  return deferred_release_enabled.load(std::memory_order_relaxed) && EnqueueReferenceRelease(reference);
+}
+
+}
+
+//----------------------------------------------------------------------
+// Function declarations
+//----------------------------------------------------------------------
+
+/*!
+ * Enables or disables deferred release of global references (disabled by default).
+ * On first activation, the background thread is started and attached to the Java VM (as daemon) -
+ * this function returns after it is attached.
+ */
+void SetDeferredReferenceRelease(bool enabled);
+
+/*! \return Whether deferred release of global references is enabled */
+inline bool IsDeferredReferenceReleaseEnabled()
+{
+  return internal::deferred_release_enabled.load(std::memory_order_relaxed);
+}
+
+/*!
+ * Blocks until all references enqueued before this call have been deleted
+ */
+void FlushDeferredReferenceReleases();
+
+/*! \return Number of references that had to be deleted immediately as queue was full (since program start) */
+uint64_t GetReferenceReleaseQueueOverflowCount();
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
@@ -0,0 +1,246 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/jni/direct_buffers.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-17
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/jni/direct_buffers.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/thread/tLock.h"
+#include <atomic>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/jni/jvm.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace jni
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+namespace
+{
+
+/*!
+ * Registered memory region.
+ * Entries are only appended to the lists and never deleted, so the lists can be traversed without locking.
+ * Entries of unregistered regions (size zero) are reused when a region in the same list is registered.
+ */
+struct tMemoryRegion
+{
+  /*! Start address of memory region - changes only while region is unregistered */
+  std::atomic<void*> address;
+
+  /*! Size of memory region in bytes - zero if region is not registered */
+  std::atomic<size_t> size;
+
+  /*! Global reference to cached direct byte buffer - NULL if not created yet */
+  std::atomic<jobject> buffer;
+
+  /*! Next entry in list */
+  tMemoryRegion* const next;
+
+  tMemoryRegion(void* address, tMemoryRegion* next) :
+    address(address),
+    size(0),
+    buffer(NULL),
+    next(next)
+  {}
+};
+
+}
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+/*! Number of lists that regions are distributed to (by address) */
+static const size_t cREGION_LIST_COUNT = 256;
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+namespace
+{
+
+/*! Mutex for registering and unregistering regions */
+rrlib::thread::tMutex regions_mutex;
+
+/*! Heads of lists with registered memory regions */
+std::atomic<tMemoryRegion*> region_lists[cREGION_LIST_COUNT];
+
+std::atomic<tMemoryRegion*>& GetRegionList(void* address)
+{
+  size_t value = reinterpret_cast<size_t>(address);
+  return region_lists[((value >> 4) ^ (value >> 12)) % cREGION_LIST_COUNT];
+}
+
+tMemoryRegion* FindRegion(void* address)
+{
+  for (tMemoryRegion* entry = GetRegionList(address).load(std::memory_order_acquire); entry != NULL; entry = entry->next)
+  {
+    if (entry->address.load(std::memory_order_acquire) == address)
+    {
+      return entry;
+    }
+  }
+  return NULL;
+}
+
+/*! Deletes global reference to buffer (if not NULL) */
+void ReleaseBuffer(jobject buffer)
+{
+  if (buffer != NULL)
+  {
+    GetEnv()->DeleteGlobalRef(buffer);
+  }
+}
+
+}
+
+jobject GetDirectByteBuffer(void* address, size_t size)
+{
+  JNIEnv* env = GetEnv();
+  tMemoryRegion* region = FindRegion(address);
+  if (region == NULL || size == 0 || region->size.load(std::memory_order_acquire) != size)
+  {
+    return env->NewDirectByteBuffer(address, size);
+  }
+  jobject buffer = region->buffer.load(std::memory_order_acquire);
+  if (region->address.load(std::memory_order_acquire) != address)
+  {
+    return env->NewDirectByteBuffer(address, size); // entry was reused for another region concurrently
+  }
+  if (buffer != NULL)
+  {
+    return env->NewLocalRef(buffer);
+  }
+
+  // Create buffer and publish it under lock (so that entry cannot be reused for another region meanwhile)
+  jobject local_buffer = env->NewDirectByteBuffer(address, size);
+  if (local_buffer == NULL)
+  {
+    return NULL; // exception is pending
+  }
+  jobject global_buffer = env->NewGlobalRef(local_buffer);
+  jobject existing_buffer = NULL;
+  {
+    rrlib::thread::tLock l(regions_mutex);
+    if (region->address.load(std::memory_order_relaxed) == address && region->size.load(std::memory_order_relaxed) == size)
+    {
+      existing_buffer = region->buffer.load(std::memory_order_relaxed);
+      if (existing_buffer == NULL)
+      {
+        region->buffer.store(global_buffer, std::memory_order_release);
+        return local_buffer;
+      }
+    }
+  }
+  env->DeleteGlobalRef(global_buffer);
+  if (existing_buffer != NULL)
+  {
+    // other thread was faster - return its buffer, so that all callers get the same one
+    env->DeleteLocalRef(local_buffer);
+    return env->NewLocalRef(existing_buffer);
+  }
+  return local_buffer; // region was unregistered or re-registered meanwhile
+}
+
+void RegisterMemoryRegion(void* address, size_t size)
+{
+  jobject old_buffer = NULL;
+  {
+    rrlib::thread::tLock l(regions_mutex);
+    tMemoryRegion* region = FindRegion(address);
+    if (region == NULL)
+    {
+      // Reuse entry of unregistered region in same list - or append new entry
+      std::atomic<tMemoryRegion*>& list = GetRegionList(address);
+      for (tMemoryRegion* entry = list.load(std::memory_order_relaxed); entry != NULL && region == NULL; entry = entry->next)
+      {
+        if (entry->size.load(std::memory_order_relaxed) == 0)
+        {
+          assert(entry->buffer.load(std::memory_order_relaxed) == NULL);
+          entry->address.store(address, std::memory_order_release);
+          region = entry;
+        }
+      }
+      if (region == NULL)
+      {
+        region = new tMemoryRegion(address, list.load(std::memory_order_relaxed));
+        list.store(region, std::memory_order_release);
+      }
+    }
+    if (region->size.load(std::memory_order_relaxed) != size)
+    {
+      old_buffer = region->buffer.exchange(NULL);
+      region->size.store(size, std::memory_order_release);
+    }
+  }
+  ReleaseBuffer(old_buffer); // JNI call after releasing lock
+}
+
+void UnregisterMemoryRegion(void* address)
+{
+  jobject old_buffer = NULL;
+  {
+    rrlib::thread::tLock l(regions_mutex);
+    tMemoryRegion* region = FindRegion(address);
+    if (region != NULL)
+    {
+      region->size.store(0, std::memory_order_release);
+      old_buffer = region->buffer.exchange(NULL);
+    }
+  }
+  ReleaseBuffer(old_buffer); // JNI call after releasing lock
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
@@ -0,0 +1,99 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/jni/direct_buffers.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-17
+ *
+ * Java direct byte buffers for native memory regions.
+ *
+ * Regions that Java code accesses repeatedly can be registered.
+ * For registered regions, the same (cached) direct byte buffer is returned on every request -
+ * instead of creating a new Java object each time.
+ * Regions must be unregistered before their memory is freed.
+ *
+ * Looking up buffers does not lock. A region must not be (re-/un-)registered
+ * while buffers for it are requested concurrently.
+ *
+ * Bookkeeping entries are reused after unregistering - so memory used for them is bounded
+ * by the maximum number of regions registered at the same time (not by the number of registrations).
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__jni__direct_buffers_h__
+#define __rrlib__jni__direct_buffers_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <jni.h>
+#include <cstddef>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace jni
+{
+
+//----------------------------------------------------------------------
+// Function declarations
+//----------------------------------------------------------------------
+
+/*!
+ * \param address Start address of native memory region
+ * \param size Size of memory region in bytes
+ * \return Local reference to direct byte buffer wrapping memory region (the cached one if region is registered with this size)
+ */
+jobject GetDirectByteBuffer(void* address, size_t size);
+
+/*!
+ * Registers native memory region - so that GetDirectByteBuffer() returns the same cached buffer for it.
+ * The buffer is created on first request. Registering a region again with a different size replaces the old entry.
+ *
+ * \param address Start address of native memory region
+ * \param size Size of memory region in bytes
+ */
+void RegisterMemoryRegion(void* address, size_t size);
+
+/*!
+ * Unregisters native memory region and releases cached buffer.
+ * Must be called before region is freed (Java code must not access any buffers of it afterwards).
+ *
+ * \param address Start address of native memory region
+ */
+void UnregisterMemoryRegion(void* address);
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
@@ -0,0 +1,229 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/jni/instrumentation.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-17
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/jni/instrumentation.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/thread/tLock.h"
+#include <pthread.h>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace jni
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+/*! Counter names */
+const char* const cCOUNTER_NAMES[] =
+{
+  "Global references created",
+  "Global references deleted",
+  "Weak global references created",
+  "Weak global references deleted",
+  "Threads attached",
+  "Threads detached",
+  "Java wrappers created",
+  "Strings converted to Java",
+  "Strings converted from Java"
+};
+static_assert(sizeof(cCOUNTER_NAMES) / sizeof(const char*) == static_cast<size_t>(tCounter::DIMENSION), "Name missing for counter");
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+namespace internal
+{
+
+__thread tThreadCounters* thread_counters = NULL;
+
+namespace
+{
+
+/*! Mutex for lists below */
+rrlib::thread::tMutex& GetMutex()
+{
+  static rrlib::thread::tMutex* mutex = new rrlib::thread::tMutex(); // never deleted: threads may terminate during static destruction
+  return *mutex;
+}
+
+/*! Counters of all running threads */
+std::vector<tThreadCounters*>& GetActiveCounters()
+{
+  static std::vector<tThreadCounters*>* counters = new std::vector<tThreadCounters*>();
+  return *counters;
+}
+
+/*! Counters of terminated threads - for reuse */
+std::vector<tThreadCounters*>& GetUnusedCounters()
+{
+  static std::vector<tThreadCounters*>* counters = new std::vector<tThreadCounters*>();
+  return *counters;
+}
+
+/*! Sums of counters of terminated threads */
+tCounterSnapshot terminated_thread_sums = tCounterSnapshot();
+
+/*! Thread-specific key whose destructor recycles counters of terminated threads */
+pthread_key_t counters_key;
+pthread_once_t counters_key_once = PTHREAD_ONCE_INIT;
+
+void RecycleThreadCounters(void* data)
+{
+  tThreadCounters* counters = static_cast<tThreadCounters*>(data);
+  rrlib::thread::tLock l(GetMutex());
+  for (size_t i = 0; i < terminated_thread_sums.size(); i++)
+  {
+    terminated_thread_sums[i] += counters->values[i].exchange(0, std::memory_order_relaxed);
+  }
+  std::vector<tThreadCounters*>& active = GetActiveCounters();
+  for (auto it = active.begin(); it != active.end(); ++it)
+  {
+    if (*it == counters)
+    {
+      active.erase(it);
+      break;
+    }
+  }
+  GetUnusedCounters().push_back(counters);
+  thread_counters = NULL;
+}
+
+void CreateCountersKey()
+{
+  __attribute__((unused)) // prevents warning in release mode
+  int res = pthread_key_create(&counters_key, &RecycleThreadCounters);
+  assert(res == 0 && "Could not create thread-specific key");
+}
+
+}
+
+tThreadCounters* RegisterThreadCounters()
+{
+  pthread_once(&counters_key_once, &CreateCountersKey);
+  tThreadCounters* counters = NULL;
+  {
+    rrlib::thread::tLock l(GetMutex());
+    std::vector<tThreadCounters*>& unused = GetUnusedCounters();
+    if (unused.empty())
+    {
+      void* memory = NULL;
+      __attribute__((unused)) // prevents warning in release mode
+      int res = posix_memalign(&memory, alignof(tThreadCounters), sizeof(tThreadCounters)); // plain 'new' does not guarantee cache line alignment
+      assert(res == 0 && "Allocating counters failed");
+      counters = new(memory) tThreadCounters();
+      for (size_t i = 0; i < static_cast<size_t>(tCounter::DIMENSION); i++)
+      {
+        counters->values[i].store(0, std::memory_order_relaxed);
+      }
+    }
+    else
+    {
+      counters = unused.back();
+      unused.pop_back();
+    }
+    GetActiveCounters().push_back(counters);
+  }
+  pthread_setspecific(counters_key, counters);
+  thread_counters = counters;
+  return counters;
+}
+
+} // namespace internal
+
+bool IsInstrumentationEnabled()
+{
+#ifdef RRLIB_JNI_INSTRUMENTATION
+  return true;
+#else
+  return false;
+#endif
+}
+
+tCounterSnapshot GetCounterSnapshot()
+{
+  rrlib::thread::tLock l(internal::GetMutex());
+  tCounterSnapshot result = internal::terminated_thread_sums;
+  for (internal::tThreadCounters * counters : internal::GetActiveCounters())
+  {
+    for (size_t i = 0; i < result.size(); i++)
+    {
+      result[i] += counters->values[i].load(std::memory_order_relaxed);
+    }
+  }
+  return result;
+}
+
+const char* GetCounterName(tCounter counter)
+{
+  return cCOUNTER_NAMES[static_cast<size_t>(counter)];
+}
+
+void PrintCounters(std::ostream& stream)
+{
+  tCounterSnapshot snapshot = GetCounterSnapshot();
+  for (size_t i = 0; i < snapshot.size(); i++)
+  {
+    stream << cCOUNTER_NAMES[i] << ": " << snapshot[i] << std::endl;
+  }
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
@@ -0,0 +1,139 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/jni/instrumentation.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-17
+ *
+ * Counters for JNI activity of rrlib_jni (global references, thread attaches, wrapper creations, string conversions).
+ *
+ * Counters are only maintained if RRLIB_JNI_INSTRUMENTATION is defined.
+ * Otherwise, RRLIB_JNI_COUNT compiles to nothing and all counters read zero.
+ * Each thread increments its own (cache-line-aligned) set of counters - they are summed up when read.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__jni__instrumentation_h__
+#define __rrlib__jni__instrumentation_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <array>
+#include <atomic>
+#include <ostream>
+#include <stdint.h>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace jni
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+/*! Counted JNI activities */
+enum class tCounter
+{
+  GLOBAL_REF_CREATED,        //!< Global reference created by tJavaObjectReference
+  GLOBAL_REF_DELETED,        //!< Global reference deleted by tJavaObjectReference
+  WEAK_GLOBAL_REF_CREATED,   //!< Weak global reference created by tJavaObjectReference
+  WEAK_GLOBAL_REF_DELETED,   //!< Weak global reference deleted by tJavaObjectReference
+  THREAD_ATTACHED,           //!< Thread attached to Java VM
+  THREAD_DETACHED,           //!< Thread detached from Java VM
+  WRAPPER_CREATED,           //!< Java wrapper created for tJNIWrappable
+  STRING_TO_JAVA,            //!< C++ string converted to Java string
+  STRING_FROM_JAVA,          //!< Java string converted to C++ string
+  DIMENSION
+};
+
+/*! Values of all counters at some point in time */
+typedef std::array<uint64_t, static_cast<size_t>(tCounter::DIMENSION)> tCounterSnapshot;
+
+namespace internal
+{
+
+/*! Counters of one thread */
+struct alignas(64) tThreadCounters
+{
+  std::atomic<uint64_t> values[static_cast<size_t>(tCounter::DIMENSION)];
+};
+
+/*! Counters of current thread - NULL if thread has not counted anything yet */
+extern __thread tThreadCounters* thread_counters;
+
+/*! Obtains counters for current thread (reusing counters of terminated threads) */
+tThreadCounters* RegisterThreadCounters();
+
+/*! Increments counter of current thread */
+inline void IncrementCounter(tCounter counter)
+{
+  tThreadCounters* counters = thread_counters;
+  if (counters == NULL)
+  {
+    counters = RegisterThreadCounters();
+  }
+  std::atomic<uint64_t>& value = counters->values[static_cast<size_t>(counter)];
+  value.store(value.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed); // only this thread writes
+}
+
+}
+
+//----------------------------------------------------------------------
+// Function declarations
+//----------------------------------------------------------------------
+
+#ifdef RRLIB_JNI_INSTRUMENTATION
+#define RRLIB_JNI_COUNT(counter) rrlib::jni::internal::IncrementCounter(rrlib::jni::tCounter::counter)
+#else
+#define RRLIB_JNI_COUNT(counter)
+#endif
+
+/*! \return Whether rrlib_jni was compiled with instrumentation (RRLIB_JNI_INSTRUMENTATION) */
+bool IsInstrumentationEnabled();
+
+/*! \return Sum of all threads' counters (including terminated threads) */
+tCounterSnapshot GetCounterSnapshot();
+
+/*! \return Name of counter */
+const char* GetCounterName(tCounter counter);
+
+/*! Prints current values of all counters to stream (one line per counter) */
+void PrintCounters(std::ostream& stream);
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
@@ -34,11 +34,19 @@
 //----------------------------------------------------------------------
 #include <jni.h>
 #include <cstring>
+#include <vector>
 
 //----------------------------------------------------------------------
 // Internal includes with ""
 //----------------------------------------------------------------------
 #include "rrlib/jni/tJNIWrappable.h"
+#include "rrlib/jni/bulk_memory.h"
+#include "rrlib/jni/deferred_deletion.h"
+#include "rrlib/jni/direct_buffers.h"
+#include "rrlib/jni/tNativeArena.h"
+#include "rrlib/jni/tArrayView.h"
+#include "rrlib/jni/tSharedRingBuffer.h"
+#include "rrlib/jni/class_loader.h"
 
 //----------------------------------------------------------------------
 // Debugging
@@ -69,14 +77,165 @@ namespace jni
 // Implementation
 //----------------------------------------------------------------------
 
+namespace
+{
+
+/*! Throws exception of specified class with specified message in Java */
+void ThrowJavaException(JNIEnv* env, const char* class_name, const char* message)
+{
+  jclass exception_class = env->FindClass(class_name);
+  if (exception_class != NULL)
+  {
+    env->ThrowNew(exception_class, message);
+    env->DeleteLocalRef(exception_class);
+  }
+}
+
+/*! Throws IllegalArgumentException with specified message in Java */
+void ThrowIllegalArgumentException(JNIEnv* env, const char* message)
+{
+  ThrowJavaException(env, "java/lang/IllegalArgumentException", message);
+}
+
+}
+
 extern "C"
 {
+  JNIEXPORT jlong JNICALL Java_org_rrlib_jni_JNICalls_arenaAllocate(JNIEnv* env, jclass class_, jlong arena, jint size, jint alignment)
+  {
+    size_t page_size = rrlib::jni::tNativeArena::GetPageSize();
+    if (size < 0)
+    {
+      ThrowIllegalArgumentException(env, "Size must not be negative");
+      return 0;
+    }
+    if (alignment < 0 || (alignment & (alignment - 1)) != 0 || (size_t)alignment > page_size)
+    {
+      ThrowIllegalArgumentException(env, "Alignment must be a power of two not exceeding the page size (or zero for page alignment)");
+      return 0;
+    }
+    void* memory = ((rrlib::jni::tNativeArena*)arena)->Allocate(size, alignment > 0 ? alignment : page_size);
+    if (memory == NULL)
+    {
+      ThrowJavaException(env, "java/lang/OutOfMemoryError", "Allocating native memory for arena failed");
+      return 0;
+    }
+    return (jlong)memory;
+  }
+  JNIEXPORT jobject JNICALL Java_org_rrlib_jni_JNICalls_arenaGetBlockBuffer(JNIEnv* env, jclass class_, jlong arena, jlong address)
+  {
+    void* block_memory = NULL;
+    size_t block_size = 0;
+    bool cached = false;
+    if (!((rrlib::jni::tNativeArena*)arena)->GetBlock((void*)address, block_memory, block_size, cached))
+    {
+      ThrowIllegalArgumentException(env, "Address was not allocated from this arena");
+      return NULL;
+    }
+    return cached ? rrlib::jni::GetDirectByteBuffer(block_memory, block_size) : env->NewDirectByteBuffer(block_memory, block_size);
+  }
+  JNIEXPORT jboolean JNICALL Java_org_rrlib_jni_JNICalls_compareAndSwapInt(JNIEnv* env, jclass class_, jlong ptr, jint expected, jint val)
+  {
+    return __atomic_compare_exchange_n((jint*)ptr, &expected, val, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST) ? JNI_TRUE : JNI_FALSE;
+  }
+  JNIEXPORT jboolean JNICALL Java_org_rrlib_jni_JNICalls_compareAndSwapLong(JNIEnv* env, jclass class_, jlong ptr, jlong expected, jlong val)
+  {
+    return __atomic_compare_exchange_n((jlong*)ptr, &expected, val, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST) ? JNI_TRUE : JNI_FALSE;
+  }
+  JNIEXPORT jint JNICALL Java_org_rrlib_jni_JNICalls_compareMemory(JNIEnv* env, jclass class_, jlong ptr1, jlong ptr2, jlong length)
+  {
+    int result = memcmp((void*)ptr1, (void*)ptr2, (size_t)length);
+    return result < 0 ? -1 : (result > 0 ? 1 : 0);
+  }
+  JNIEXPORT void JNICALL Java_org_rrlib_jni_JNICalls_copyMemory(JNIEnv* env, jclass class_, jlong dest, jlong src, jlong length)
+  {
+    rrlib::jni::CopyMemory((void*)dest, (void*)src, (size_t)length);
+  }
+  JNIEXPORT void JNICALL Java_org_rrlib_jni_JNICalls_copyMemory2D(JNIEnv* env, jclass class_, jlong dest, jlong dest_stride, jlong src, jlong src_stride, jlong row_length, jlong rows)
+  {
+    rrlib::jni::CopyMemory2D((void*)dest, (size_t)dest_stride, (void*)src, (size_t)src_stride, (size_t)row_length, (size_t)rows);
+  }
+  JNIEXPORT jlong JNICALL Java_org_rrlib_jni_JNICalls_createArena(JNIEnv* env, jclass class_, jlong block_size)
+  {
+    if (block_size <= 0)
+    {
+      ThrowIllegalArgumentException(env, "Block size must be positive");
+      return 0;
+    }
+    return (jlong)new rrlib::jni::tNativeArena(block_size);
+  }
+  JNIEXPORT jlong JNICALL Java_org_rrlib_jni_JNICalls_createRingBuffer(JNIEnv* env, jclass class_, jint capacity)
+  {
+    if (capacity < 64 || (capacity & (capacity - 1)) != 0)
+    {
+      ThrowIllegalArgumentException(env, "Capacity must be a power of two and at least 64");
+      return 0;
+    }
+    return (jlong)new rrlib::jni::tSharedRingBuffer(capacity);
+  }
+  JNIEXPORT void JNICALL Java_org_rrlib_jni_JNICalls_deleteArena(JNIEnv* env, jclass class_, jlong arena)
+  {
+    delete (rrlib::jni::tNativeArena*)arena;
+  }
   JNIEXPORT void JNICALL Java_org_rrlib_jni_JNICalls_deleteJNIWrappable(JNIEnv* env, jclass class_, jlong pointer)
   {
     rrlib::jni::tJNIWrappable* obj = (rrlib::jni::tJNIWrappable*)pointer;
     obj->SetJavaWrapper(NULL, false); // avoids that Java "destructor" is invoked (again)
     delete obj;
   }
+  JNIEXPORT void JNICALL Java_org_rrlib_jni_JNICalls_deleteJNIWrappableDeferred(JNIEnv* env, jclass class_, jlong pointer)
+  {
+    rrlib::jni::DeleteDeferred((rrlib::jni::tJNIWrappable*)pointer);
+  }
+  JNIEXPORT void JNICALL Java_org_rrlib_jni_JNICalls_deleteJNIWrappables(JNIEnv* env, jclass class_, jlongArray pointers)
+  {
+    rrlib::jni::tArrayView<jlong> view(pointers, env);
+    for (jlong pointer : view)
+    {
+      rrlib::jni::tJNIWrappable* obj = (rrlib::jni::tJNIWrappable*)pointer;
+      if (obj != NULL)
+      {
+        obj->SetJavaWrapper(NULL, false); // avoids that Java "destructor" is invoked (again)
+        delete obj;
+      }
+    }
+    view.Abort();
+  }
+  JNIEXPORT void JNICALL Java_org_rrlib_jni_JNICalls_deleteJNIWrappablesDeferred(JNIEnv* env, jclass class_, jlongArray pointers)
+  {
+    rrlib::jni::tArrayView<jlong> view(pointers, env);
+    std::vector<rrlib::jni::tJNIWrappable*> objects;
+    objects.reserve(view.Size());
+    for (jlong pointer : view)
+    {
+      objects.push_back((rrlib::jni::tJNIWrappable*)pointer);
+    }
+    view.Abort();
+    if (!objects.empty())
+    {
+      rrlib::jni::DeleteDeferred(&objects[0], objects.size());
+    }
+  }
+  JNIEXPORT void JNICALL Java_org_rrlib_jni_JNICalls_deleteRingBuffer(JNIEnv* env, jclass class_, jlong ring_buffer)
+  {
+    delete (rrlib::jni::tSharedRingBuffer*)ring_buffer;
+  }
+  JNIEXPORT jint JNICALL Java_org_rrlib_jni_JNICalls_exchangeInt(JNIEnv* env, jclass class_, jlong ptr, jint val)
+  {
+    return __atomic_exchange_n((jint*)ptr, val, __ATOMIC_SEQ_CST);
+  }
+  JNIEXPORT jlong JNICALL Java_org_rrlib_jni_JNICalls_exchangeLong(JNIEnv* env, jclass class_, jlong ptr, jlong val)
+  {
+    return __atomic_exchange_n((jlong*)ptr, val, __ATOMIC_SEQ_CST);
+  }
+  JNIEXPORT jint JNICALL Java_org_rrlib_jni_JNICalls_fetchAddInt(JNIEnv* env, jclass class_, jlong ptr, jint delta)
+  {
+    return __atomic_fetch_add((jint*)ptr, delta, __ATOMIC_SEQ_CST);
+  }
+  JNIEXPORT jlong JNICALL Java_org_rrlib_jni_JNICalls_fetchAddLong(JNIEnv* env, jclass class_, jlong ptr, jlong delta)
+  {
+    return __atomic_fetch_add((jlong*)ptr, delta, __ATOMIC_SEQ_CST);
+  }
   JNIEXPORT jlong JNICALL Java_org_rrlib_jni_JNICalls_getBufferPointer(JNIEnv* env, jclass class_, jobject buf)
   {
     return (jlong)env->GetDirectBufferAddress(buf);
@@ -85,26 +244,41 @@ extern "C"
   {
     return *((jbyte*)ptr);
   }
+  JNIEXPORT void JNICALL Java_org_rrlib_jni_JNICalls_getByteArray(JNIEnv* env, jclass class_, jlong ptr, jbyteArray array, jint offset, jint length)
+  {
+    env->SetByteArrayRegion(array, offset, length, (jbyte*)ptr);
+  }
   JNIEXPORT jobject JNICALL Java_org_rrlib_jni_JNICalls_getCByteBuffer(JNIEnv* env, jclass class_, jlong ptr, jint size)
   {
-    jobject result;
-    result = env->NewDirectByteBuffer((void*)ptr, size);
-    return result;
+    return rrlib::jni::GetDirectByteBuffer((void*)ptr, size);
   }
   JNIEXPORT jdouble JNICALL Java_org_rrlib_jni_JNICalls_getDouble(JNIEnv* env, jclass class_, jlong ptr)
   {
     return *((jdouble*)ptr);
   }
+  JNIEXPORT void JNICALL Java_org_rrlib_jni_JNICalls_getDoubleArray(JNIEnv* env, jclass class_, jlong ptr, jdoubleArray array, jint offset, jint length)
+  {
+    env->SetDoubleArrayRegion(array, offset, length, (jdouble*)ptr);
+  }
   JNIEXPORT jfloat JNICALL Java_org_rrlib_jni_JNICalls_getFloat(JNIEnv* env, jclass class_, jlong ptr)
   {
     return *((jfloat*)ptr);
   }
+  JNIEXPORT void JNICALL Java_org_rrlib_jni_JNICalls_getFloatArray(JNIEnv* env, jclass class_, jlong ptr, jfloatArray array, jint offset, jint length)
+  {
+    env->SetFloatArrayRegion(array, offset, length, (jfloat*)ptr);
+  }
   JNIEXPORT jint JNICALL Java_org_rrlib_jni_JNICalls_getInt(JNIEnv* env, jclass class_, jlong ptr)
   {
     return *((jint*)ptr);
   }
+  JNIEXPORT void JNICALL Java_org_rrlib_jni_JNICalls_getIntArray(JNIEnv* env, jclass class_, jlong ptr, jintArray array, jint offset, jint length)
+  {
+    env->SetIntArrayRegion(array, offset, length, (jint*)ptr);
+  }
   JNIEXPORT jlong JNICALL Java_org_rrlib_jni_JNICalls_getJavaVM(JNIEnv* env, jclass class_)
   {
+    rrlib::jni::internal::SetClassLoader(env, class_);
     JavaVM* jvm = rrlib::jni::GetJavaVM();
     if (jvm != NULL)
     {
@@ -119,35 +293,83 @@ extern "C"
   {
     return *((jlong*)ptr);
   }
+  JNIEXPORT void JNICALL Java_org_rrlib_jni_JNICalls_getLongArray(JNIEnv* env, jclass class_, jlong ptr, jlongArray array, jint offset, jint length)
+  {
+    env->SetLongArrayRegion(array, offset, length, (jlong*)ptr);
+  }
   JNIEXPORT jlong JNICALL Java_org_rrlib_jni_JNICalls_getPointer(JNIEnv* env, jclass class_, jlong address, jint index)
   {
     void** array = (void**)address;
     return (jlong)array[index];
   }
+  JNIEXPORT jobject JNICALL Java_org_rrlib_jni_JNICalls_getRingBufferByteBuffer(JNIEnv* env, jclass class_, jlong ring_buffer)
+  {
+    return ((rrlib::jni::tSharedRingBuffer*)ring_buffer)->GetJavaBuffer(env);
+  }
   JNIEXPORT jshort JNICALL Java_org_rrlib_jni_JNICalls_getShort(JNIEnv* env, jclass class_, jlong ptr)
   {
     return *((jshort*)ptr);
   }
+  JNIEXPORT void JNICALL Java_org_rrlib_jni_JNICalls_getShortArray(JNIEnv* env, jclass class_, jlong ptr, jshortArray array, jint offset, jint length)
+  {
+    env->SetShortArrayRegion(array, offset, length, (jshort*)ptr);
+  }
+  JNIEXPORT jint JNICALL Java_org_rrlib_jni_JNICalls_loadAcquireInt(JNIEnv* env, jclass class_, jlong ptr)
+  {
+    return __atomic_load_n((jint*)ptr, __ATOMIC_ACQUIRE);
+  }
+  JNIEXPORT jlong JNICALL Java_org_rrlib_jni_JNICalls_loadAcquireLong(JNIEnv* env, jclass class_, jlong ptr)
+  {
+    return __atomic_load_n((jlong*)ptr, __ATOMIC_ACQUIRE);
+  }
   JNIEXPORT void JNICALL Java_org_rrlib_jni_JNICalls_memcpy(JNIEnv* env, jclass class_, jlong dest, jlong src, jint length)
   {
-    memcpy((void*)src, (void*)dest, (int)length);
+    memcpy((void*)dest, (void*)src, (size_t)length);
+  }
+  JNIEXPORT void JNICALL Java_org_rrlib_jni_JNICalls_moveMemory(JNIEnv* env, jclass class_, jlong dest, jlong src, jlong length)
+  {
+    memmove((void*)dest, (void*)src, (size_t)length);
+  }
+  JNIEXPORT void JNICALL Java_org_rrlib_jni_JNICalls_registerMemoryRegion(JNIEnv* env, jclass class_, jlong ptr, jint size)
+  {
+    rrlib::jni::RegisterMemoryRegion((void*)ptr, size);
+  }
+  JNIEXPORT void JNICALL Java_org_rrlib_jni_JNICalls_resetArena(JNIEnv* env, jclass class_, jlong arena)
+  {
+    ((rrlib::jni::tNativeArena*)arena)->Reset();
   }
   JNIEXPORT void JNICALL Java_org_rrlib_jni_JNICalls_setByte(JNIEnv* env, jclass class_, jlong ptr, jbyte val)
   {
     *((jbyte*)ptr) = val;
   }
+  JNIEXPORT void JNICALL Java_org_rrlib_jni_JNICalls_setByteArray(JNIEnv* env, jclass class_, jlong ptr, jbyteArray array, jint offset, jint length)
+  {
+    env->GetByteArrayRegion(array, offset, length, (jbyte*)ptr);
+  }
   JNIEXPORT void JNICALL Java_org_rrlib_jni_JNICalls_setDouble(JNIEnv* env, jclass class_, jlong ptr, jdouble val)
   {
     *((jdouble*)ptr) = val;
   }
+  JNIEXPORT void JNICALL Java_org_rrlib_jni_JNICalls_setDoubleArray(JNIEnv* env, jclass class_, jlong ptr, jdoubleArray array, jint offset, jint length)
+  {
+    env->GetDoubleArrayRegion(array, offset, length, (jdouble*)ptr);
+  }
   JNIEXPORT void JNICALL Java_org_rrlib_jni_JNICalls_setFloat(JNIEnv* env, jclass class_, jlong ptr, jfloat val)
   {
     *((jfloat*)ptr) = val;
   }
+  JNIEXPORT void JNICALL Java_org_rrlib_jni_JNICalls_setFloatArray(JNIEnv* env, jclass class_, jlong ptr, jfloatArray array, jint offset, jint length)
+  {
+    env->GetFloatArrayRegion(array, offset, length, (jfloat*)ptr);
+  }
   JNIEXPORT void JNICALL Java_org_rrlib_jni_JNICalls_setInt(JNIEnv* env, jclass class_, jlong ptr, jint val)
   {
     *((jint*)ptr) = val;
   }
+  JNIEXPORT void JNICALL Java_org_rrlib_jni_JNICalls_setIntArray(JNIEnv* env, jclass class_, jlong ptr, jintArray array, jint offset, jint length)
+  {
+    env->GetIntArrayRegion(array, offset, length, (jint*)ptr);
+  }
   JNIEXPORT void JNICALL Java_org_rrlib_jni_JNICalls_setJavaObject(JNIEnv* env, jclass class_, jlong pointer, jobject object, jboolean java_responsible)
   {
     rrlib::jni::tJNIWrappable* obj = (rrlib::jni::tJNIWrappable*)pointer;
@@ -157,6 +379,14 @@ extern "C"
   {
     *((jlong*)ptr) = val;
   }
+  JNIEXPORT void JNICALL Java_org_rrlib_jni_JNICalls_setLongArray(JNIEnv* env, jclass class_, jlong ptr, jlongArray array, jint offset, jint length)
+  {
+    env->GetLongArrayRegion(array, offset, length, (jlong*)ptr);
+  }
+  JNIEXPORT void JNICALL Java_org_rrlib_jni_JNICalls_setMemory(JNIEnv* env, jclass class_, jlong dest, jint value, jlong length)
+  {
+    memset((void*)dest, value, (size_t)length);
+  }
   JNIEXPORT void JNICALL Java_org_rrlib_jni_JNICalls_setPointer(JNIEnv* env, jclass class_, jlong arraypointer, jint index, jlong pointer)
   {
     void** array = (void**)arraypointer;
@@ -166,10 +396,22 @@ extern "C"
   {
     *((jshort*)ptr) = val;
   }
+  JNIEXPORT void JNICALL Java_org_rrlib_jni_JNICalls_setShortArray(JNIEnv* env, jclass class_, jlong ptr, jshortArray array, jint offset, jint length)
+  {
+    env->GetShortArrayRegion(array, offset, length, (jshort*)ptr);
+  }
   JNIEXPORT jint JNICALL Java_org_rrlib_jni_JNICalls_sizeOfPointer(JNIEnv* env, jclass class_)
   {
     return sizeof(void*);
   }
+  JNIEXPORT void JNICALL Java_org_rrlib_jni_JNICalls_storeReleaseInt(JNIEnv* env, jclass class_, jlong ptr, jint val)
+  {
+    __atomic_store_n((jint*)ptr, val, __ATOMIC_RELEASE);
+  }
+  JNIEXPORT void JNICALL Java_org_rrlib_jni_JNICalls_storeReleaseLong(JNIEnv* env, jclass class_, jlong ptr, jlong val)
+  {
+    __atomic_store_n((jlong*)ptr, val, __ATOMIC_RELEASE);
+  }
   JNIEXPORT jint JNICALL Java_org_rrlib_jni_JNICalls_strlen(JNIEnv* env, jclass class_, jlong ptr)
   {
     return strlen((char*)ptr);
@@ -180,7 +422,140 @@ extern "C"
     result = env->NewStringUTF((char*)pointer);
     return result;
   }
+  JNIEXPORT void JNICALL Java_org_rrlib_jni_JNICalls_unregisterMemoryRegion(JNIEnv* env, jclass class_, jlong ptr)
+  {
+    rrlib::jni::UnregisterMemoryRegion((void*)ptr);
+  }
+
+} // extern C
+
+namespace
+{
+
+/*! Natives of org.rrlib.jni.JNICalls - registered in JNI_OnLoad */
+const JNINativeMethod cJNI_CALLS_NATIVES[] =
+{
+  { (char*)"arenaAllocate", (char*)"(JII)J", (void*)&Java_org_rrlib_jni_JNICalls_arenaAllocate },
+  { (char*)"arenaGetBlockBuffer", (char*)"(JJ)Ljava/nio/ByteBuffer;", (void*)&Java_org_rrlib_jni_JNICalls_arenaGetBlockBuffer },
+  { (char*)"compareAndSwapInt", (char*)"(JII)Z", (void*)&Java_org_rrlib_jni_JNICalls_compareAndSwapInt },
+  { (char*)"compareAndSwapLong", (char*)"(JJJ)Z", (void*)&Java_org_rrlib_jni_JNICalls_compareAndSwapLong },
+  { (char*)"compareMemory", (char*)"(JJJ)I", (void*)&Java_org_rrlib_jni_JNICalls_compareMemory },
+  { (char*)"copyMemory", (char*)"(JJJ)V", (void*)&Java_org_rrlib_jni_JNICalls_copyMemory },
+  { (char*)"copyMemory2D", (char*)"(JJJJJJ)V", (void*)&Java_org_rrlib_jni_JNICalls_copyMemory2D },
+  { (char*)"createArena", (char*)"(J)J", (void*)&Java_org_rrlib_jni_JNICalls_createArena },
+  { (char*)"createRingBuffer", (char*)"(I)J", (void*)&Java_org_rrlib_jni_JNICalls_createRingBuffer },
+  { (char*)"deleteArena", (char*)"(J)V", (void*)&Java_org_rrlib_jni_JNICalls_deleteArena },
+  { (char*)"deleteJNIWrappable", (char*)"(J)V", (void*)&Java_org_rrlib_jni_JNICalls_deleteJNIWrappable },
+  { (char*)"deleteJNIWrappableDeferred", (char*)"(J)V", (void*)&Java_org_rrlib_jni_JNICalls_deleteJNIWrappableDeferred },
+  { (char*)"deleteJNIWrappables", (char*)"([J)V", (void*)&Java_org_rrlib_jni_JNICalls_deleteJNIWrappables },
+  { (char*)"deleteJNIWrappablesDeferred", (char*)"([J)V", (void*)&Java_org_rrlib_jni_JNICalls_deleteJNIWrappablesDeferred },
+  { (char*)"deleteRingBuffer", (char*)"(J)V", (void*)&Java_org_rrlib_jni_JNICalls_deleteRingBuffer },
+  { (char*)"exchangeInt", (char*)"(JI)I", (void*)&Java_org_rrlib_jni_JNICalls_exchangeInt },
+  { (char*)"exchangeLong", (char*)"(JJ)J", (void*)&Java_org_rrlib_jni_JNICalls_exchangeLong },
+  { (char*)"fetchAddInt", (char*)"(JI)I", (void*)&Java_org_rrlib_jni_JNICalls_fetchAddInt },
+  { (char*)"fetchAddLong", (char*)"(JJ)J", (void*)&Java_org_rrlib_jni_JNICalls_fetchAddLong },
+  { (char*)"getBufferPointer", (char*)"(Ljava/nio/ByteBuffer;)J", (void*)&Java_org_rrlib_jni_JNICalls_getBufferPointer },
+  { (char*)"getByte", (char*)"(J)B", (void*)&Java_org_rrlib_jni_JNICalls_getByte },
+  { (char*)"getByteArray", (char*)"(J[BII)V", (void*)&Java_org_rrlib_jni_JNICalls_getByteArray },
+  { (char*)"getCByteBuffer", (char*)"(JI)Ljava/nio/ByteBuffer;", (void*)&Java_org_rrlib_jni_JNICalls_getCByteBuffer },
+  { (char*)"getDouble", (char*)"(J)D", (void*)&Java_org_rrlib_jni_JNICalls_getDouble },
+  { (char*)"getDoubleArray", (char*)"(J[DII)V", (void*)&Java_org_rrlib_jni_JNICalls_getDoubleArray },
+  { (char*)"getFloat", (char*)"(J)F", (void*)&Java_org_rrlib_jni_JNICalls_getFloat },
+  { (char*)"getFloatArray", (char*)"(J[FII)V", (void*)&Java_org_rrlib_jni_JNICalls_getFloatArray },
+  { (char*)"getInt", (char*)"(J)I", (void*)&Java_org_rrlib_jni_JNICalls_getInt },
+  { (char*)"getIntArray", (char*)"(J[III)V", (void*)&Java_org_rrlib_jni_JNICalls_getIntArray },
+  { (char*)"getJavaVM", (char*)"()J", (void*)&Java_org_rrlib_jni_JNICalls_getJavaVM },
+  { (char*)"getLong", (char*)"(J)J", (void*)&Java_org_rrlib_jni_JNICalls_getLong },
+  { (char*)"getLongArray", (char*)"(J[JII)V", (void*)&Java_org_rrlib_jni_JNICalls_getLongArray },
+  { (char*)"getPointer", (char*)"(JI)J", (void*)&Java_org_rrlib_jni_JNICalls_getPointer },
+  { (char*)"getRingBufferByteBuffer", (char*)"(J)Ljava/nio/ByteBuffer;", (void*)&Java_org_rrlib_jni_JNICalls_getRingBufferByteBuffer },
+  { (char*)"getShort", (char*)"(J)S", (void*)&Java_org_rrlib_jni_JNICalls_getShort },
+  { (char*)"getShortArray", (char*)"(J[SII)V", (void*)&Java_org_rrlib_jni_JNICalls_getShortArray },
+  { (char*)"loadAcquireInt", (char*)"(J)I", (void*)&Java_org_rrlib_jni_JNICalls_loadAcquireInt },
+  { (char*)"loadAcquireLong", (char*)"(J)J", (void*)&Java_org_rrlib_jni_JNICalls_loadAcquireLong },
+  { (char*)"memcpy", (char*)"(JJI)V", (void*)&Java_org_rrlib_jni_JNICalls_memcpy },
+  { (char*)"moveMemory", (char*)"(JJJ)V", (void*)&Java_org_rrlib_jni_JNICalls_moveMemory },
+  { (char*)"registerMemoryRegion", (char*)"(JI)V", (void*)&Java_org_rrlib_jni_JNICalls_registerMemoryRegion },
+  { (char*)"resetArena", (char*)"(J)V", (void*)&Java_org_rrlib_jni_JNICalls_resetArena },
+  { (char*)"setByte", (char*)"(JB)V", (void*)&Java_org_rrlib_jni_JNICalls_setByte },
+  { (char*)"setByteArray", (char*)"(J[BII)V", (void*)&Java_org_rrlib_jni_JNICalls_setByteArray },
+  { (char*)"setDouble", (char*)"(JD)V", (void*)&Java_org_rrlib_jni_JNICalls_setDouble },
+  { (char*)"setDoubleArray", (char*)"(J[DII)V", (void*)&Java_org_rrlib_jni_JNICalls_setDoubleArray },
+  { (char*)"setFloat", (char*)"(JF)V", (void*)&Java_org_rrlib_jni_JNICalls_setFloat },
+  { (char*)"setFloatArray", (char*)"(J[FII)V", (void*)&Java_org_rrlib_jni_JNICalls_setFloatArray },
+  { (char*)"setInt", (char*)"(JI)V", (void*)&Java_org_rrlib_jni_JNICalls_setInt },
+  { (char*)"setIntArray", (char*)"(J[III)V", (void*)&Java_org_rrlib_jni_JNICalls_setIntArray },
+  { (char*)"setJavaObject", (char*)"(JLjava/lang/Object;Z)V", (void*)&Java_org_rrlib_jni_JNICalls_setJavaObject },
+  { (char*)"setLong", (char*)"(JJ)V", (void*)&Java_org_rrlib_jni_JNICalls_setLong },
+  { (char*)"setLongArray", (char*)"(J[JII)V", (void*)&Java_org_rrlib_jni_JNICalls_setLongArray },
+  { (char*)"setMemory", (char*)"(JIJ)V", (void*)&Java_org_rrlib_jni_JNICalls_setMemory },
+  { (char*)"setPointer", (char*)"(JIJ)V", (void*)&Java_org_rrlib_jni_JNICalls_setPointer },
+  { (char*)"setShort", (char*)"(JS)V", (void*)&Java_org_rrlib_jni_JNICalls_setShort },
+  { (char*)"setShortArray", (char*)"(J[SII)V", (void*)&Java_org_rrlib_jni_JNICalls_setShortArray },
+  { (char*)"sizeOfPointer", (char*)"()I", (void*)&Java_org_rrlib_jni_JNICalls_sizeOfPointer },
+  { (char*)"storeReleaseInt", (char*)"(JI)V", (void*)&Java_org_rrlib_jni_JNICalls_storeReleaseInt },
+  { (char*)"storeReleaseLong", (char*)"(JJ)V", (void*)&Java_org_rrlib_jni_JNICalls_storeReleaseLong },
+  { (char*)"strlen", (char*)"(J)I", (void*)&Java_org_rrlib_jni_JNICalls_strlen },
+  { (char*)"toString", (char*)"(J)Ljava/lang/String;", (void*)&Java_org_rrlib_jni_JNICalls_toString },
+  { (char*)"unregisterMemoryRegion", (char*)"(J)V", (void*)&Java_org_rrlib_jni_JNICalls_unregisterMemoryRegion },
+};
+
+/*!
+ * Registers all natives of org.rrlib.jni.JNICalls.
+ * If the Java class does not declare some of them (e.g. older version), the others are registered one by one.
+ */
+void RegisterNatives(JNIEnv* env, jclass jni_calls)
+{
+  const jint count = sizeof(cJNI_CALLS_NATIVES) / sizeof(JNINativeMethod);
+  if (env->RegisterNatives(jni_calls, cJNI_CALLS_NATIVES, count) == 0)
+  {
+    return;
+  }
+  env->ExceptionClear();
+  for (jint i = 0; i < count; i++)
+  {
+    if (env->RegisterNatives(jni_calls, &cJNI_CALLS_NATIVES[i], 1) != 0)
+    {
+      env->ExceptionClear(); // native remains resolved by symbol lookup (if at all)
+    }
+  }
+}
+
+}
+
+extern "C"
+{
+  JNIEXPORT jint JNICALL JNI_OnLoad(JavaVM* vm, void* reserved)
+  {
+    JNIEnv* env = NULL;
+    if (vm->GetEnv((void**)&env, JNI_VERSION_1_6) != JNI_OK)
+    {
+      return JNI_ERR;
+    }
+    rrlib::jni::SetJavaVM(vm);
 
+    jclass jni_calls = env->FindClass("org/rrlib/jni/JNICalls");
+    if (jni_calls == NULL)
+    {
+      env->ExceptionClear(); // library is used without Java part - natives are not needed
+    }
+    else
+    {
+      RegisterNatives(env, jni_calls);
+      rrlib::jni::internal::SetClassLoader(env, jni_calls);
+      env->DeleteLocalRef(jni_calls);
+    }
+    return JNI_VERSION_1_6;
+  }
+  JNIEXPORT void JNICALL JNI_OnUnload(JavaVM* vm, void* reserved)
+  {
+    JNIEnv* env = NULL;
+    if (vm->GetEnv((void**)&env, JNI_VERSION_1_2) == JNI_OK)
+    {
+      rrlib::jni::internal::ClearWrapperClassCache(env);
+      rrlib::jni::internal::ClearClassCache(env);
+    }
+  }
 } // extern C
 
 //----------------------------------------------------------------------
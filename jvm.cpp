@@ -32,10 +32,13 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
+#include <atomic>
+#include <pthread.h>
 
 //----------------------------------------------------------------------
 // Internal includes with ""
 //----------------------------------------------------------------------
+#include "rrlib/jni/instrumentation.h"
 
 //----------------------------------------------------------------------
 // Debugging
@@ -75,13 +78,69 @@ JavaVM* jvm = NULL;
 /*! (Cached) Pointer to JNIEnv of current thread */
 __thread JNIEnv* env = NULL;
 
+namespace
+{
+
+/*! Thread-specific key with non-NULL value for threads attached by rrlib_jni - its destructor detaches threads on exit */
+pthread_key_t detach_key;
+pthread_once_t detach_key_once = PTHREAD_ONCE_INIT;
+
+/*! Attach threads as daemon threads? */
+std::atomic<bool> attach_as_daemon(false);
+
+/*! Number of threads currently attached by rrlib_jni */
+std::atomic<size_t> attached_thread_count(0);
+
+/*! Number of thread attaches since program start */
+std::atomic<uint64_t> total_thread_attach_count(0);
+
+void Detach()
+{
+  jvm->DetachCurrentThread();
+  env = NULL;
+  attached_thread_count.fetch_sub(1, std::memory_order_relaxed);
+  RRLIB_JNI_COUNT(THREAD_DETACHED);
+}
+
+void DetachOnThreadExit(void*)
+{
+  Detach();
+}
+
+void CreateDetachKey()
+{
+  __attribute__((unused)) // prevents warning in release mode
+  int res = pthread_key_create(&detach_key, &DetachOnThreadExit);
+  assert(res == 0 && "Could not create thread-specific key");
+}
+
+}
+
 JNIEnv* AttachThread()
+{
+  return AttachThread(attach_as_daemon.load(std::memory_order_relaxed));
+}
+
+JNIEnv* AttachThread(bool daemon)
 {
   assert(jvm != NULL && "No Java VM set - cannot attach thread and get JNIEnv");
   JNIEnv* result = NULL;
+
+  // Threads created by Java VM (or attached elsewhere) must not be detached by us
+  if (jvm->GetEnv((void**) &result, JNI_VERSION_1_2) == JNI_OK)
+  {
+    env = result;
+    return result;
+  }
+
   __attribute__((unused)) // prevents warning in release mode
-  jint res = jvm->AttachCurrentThread((void**) & result, NULL);
+  jint res = daemon ? jvm->AttachCurrentThreadAsDaemon((void**) & result, NULL) : jvm->AttachCurrentThread((void**) & result, NULL);
   assert(res >= 0 && "Java VM Thread Attach failed");
+  pthread_once(&detach_key_once, &CreateDetachKey);
+  pthread_setspecific(detach_key, result);
+  attached_thread_count.fetch_add(1, std::memory_order_relaxed);
+  total_thread_attach_count.fetch_add(1, std::memory_order_relaxed);
+  RRLIB_JNI_COUNT(THREAD_ATTACHED);
   env = result;
   return result;
 }
@@ -97,6 +156,32 @@ void SetJavaVM(JavaVM* jvm)
   assert(internal::jvm == NULL && "Java VM already set to a different instance");
   internal::jvm = jvm;
 }
+
+void SetAttachThreadsAsDaemon(bool daemon)
+{
+  internal::attach_as_daemon.store(daemon, std::memory_order_relaxed);
+}
+
+void DetachThread()
+{
+  pthread_once(&internal::detach_key_once, &internal::CreateDetachKey);
+  if (pthread_getspecific(internal::detach_key) != NULL)
+  {
+    pthread_setspecific(internal::detach_key, NULL);
+    internal::Detach();
+  }
+}
+
+size_t GetAttachedThreadCount()
+{
+  return internal::attached_thread_count.load(std::memory_order_relaxed);
+}
+
+uint64_t GetTotalThreadAttachCount()
+{
+  return internal::total_thread_attach_count.load(std::memory_order_relaxed);
+}
+
 //----------------------------------------------------------------------
 // End of namespace declaration
 //----------------------------------------------------------------------
@@ -36,6 +36,8 @@
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
 #include <jni.h>
+#include <cstddef>
+#include <stdint.h>
 
 //----------------------------------------------------------------------
 // Internal includes with ""
@@ -63,8 +65,18 @@ extern JavaVM* jvm;
 /*! (Cached) Pointer to JNIEnv of current thread */
 extern __thread JNIEnv* env;
 
+/*!
+ * Attaches current thread to Java VM (if it is not attached already) and caches its JNIEnv.
+ * Threads attached by this function are detached automatically when they exit.
+ */
 JNIEnv* AttachThread();
 
+/*!
+ * As AttachThread(), but with explicit choice whether to attach as daemon thread
+ * (used by rrlib_jni's own background threads, which must never delay Java VM shutdown)
+ */
+JNIEnv* AttachThread(bool daemon);
+
 }
 
 //----------------------------------------------------------------------
@@ -80,6 +92,28 @@ inline JavaVM* GetJavaVM()
   return internal::jvm;
 }
 
+/*!
+ * Set whether threads should be attached as daemon threads.
+ * Java VM does not wait for daemon threads to terminate on shutdown.
+ * Affects threads attached after this call (default: false).
+ */
+void SetAttachThreadsAsDaemon(bool daemon);
+
+/*!
+ * Detaches current thread from Java VM - if it was attached by rrlib_jni.
+ * This happens automatically on thread exit - so this only needs to be called
+ * if long-lived threads should not be visible to the Java VM anymore
+ * (e.g. to avoid scanning them at safepoints).
+ * Any local references obtained on this thread become invalid.
+ */
+void DetachThread();
+
+/*! \return Number of threads that are currently attached to Java VM by rrlib_jni */
+size_t GetAttachedThreadCount();
+
+/*! \return Number of times threads were attached to Java VM by rrlib_jni (since program start) */
+uint64_t GetTotalThreadAttachCount();
+
 /*! Get JNI Env for current thread */
 inline JNIEnv* GetEnv()
 {
@@ -0,0 +1,304 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/jni/tArrayView.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-17
+ *
+ * \brief   Contains tArrayView
+ *
+ * \b tArrayView
+ *
+ * Provides access to the elements of a Java primitive array
+ * (via Get<Type>ArrayElements). Elements are released when the view
+ * goes out of scope.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__jni__tArrayView_h__
+#define __rrlib__jni__tArrayView_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/util/tNoncopyable.h"
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/jni/jvm.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace jni
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+namespace internal
+{
+
+/*! Type-specific JNI functions for Java primitive arrays with element type T */
+template <typename T>
+struct tPrimitiveArrayTraits;
+
+/*! Element type of Java primitive array type TArray */
+template <typename TArray>
+struct tPrimitiveArrayElement;
+
+#define RRLIB_JNI_PRIMITIVE_ARRAY_TRAITS(element_type, array_type, name) \
+  template <> \
+  struct tPrimitiveArrayTraits<element_type> \
+  { \
+    typedef array_type tArray; \
+    static array_type New(JNIEnv* env, jsize length) { return env->New ## name ## Array(length); } \
+    static element_type* GetElements(JNIEnv* env, array_type array, jboolean* is_copy) { return env->Get ## name ## ArrayElements(array, is_copy); } \
+    static void ReleaseElements(JNIEnv* env, array_type array, element_type* elements, jint mode) { env->Release ## name ## ArrayElements(array, elements, mode); } \
+    static void GetRegion(JNIEnv* env, array_type array, jsize start, jsize length, element_type* buffer) { env->Get ## name ## ArrayRegion(array, start, length, buffer); } \
+    static void SetRegion(JNIEnv* env, array_type array, jsize start, jsize length, const element_type* buffer) { env->Set ## name ## ArrayRegion(array, start, length, buffer); } \
+  }; \
+  template <> \
+  struct tPrimitiveArrayElement<array_type> \
+  { \
+    typedef element_type type; \
+  };
+
+RRLIB_JNI_PRIMITIVE_ARRAY_TRAITS(jboolean, jbooleanArray, Boolean)
+RRLIB_JNI_PRIMITIVE_ARRAY_TRAITS(jbyte, jbyteArray, Byte)
+RRLIB_JNI_PRIMITIVE_ARRAY_TRAITS(jchar, jcharArray, Char)
+RRLIB_JNI_PRIMITIVE_ARRAY_TRAITS(jshort, jshortArray, Short)
+RRLIB_JNI_PRIMITIVE_ARRAY_TRAITS(jint, jintArray, Int)
+RRLIB_JNI_PRIMITIVE_ARRAY_TRAITS(jlong, jlongArray, Long)
+RRLIB_JNI_PRIMITIVE_ARRAY_TRAITS(jfloat, jfloatArray, Float)
+RRLIB_JNI_PRIMITIVE_ARRAY_TRAITS(jdouble, jdoubleArray, Double)
+
+#undef RRLIB_JNI_PRIMITIVE_ARRAY_TRAITS
+
+/*! Acquires and releases elements via Get<Type>ArrayElements / Release<Type>ArrayElements */
+template <typename T>
+struct tArrayElementsAccess
+{
+  typedef typename tPrimitiveArrayTraits<T>::tArray tArray;
+  static T* Acquire(JNIEnv* env, tArray array, jboolean* is_copy)
+  {
+    return tPrimitiveArrayTraits<T>::GetElements(env, array, is_copy);
+  }
+  static void Release(JNIEnv* env, tArray array, T* elements, jint mode)
+  {
+    tPrimitiveArrayTraits<T>::ReleaseElements(env, array, elements, mode);
+  }
+};
+
+/*!
+ * Common implementation of tArrayView and tCriticalArrayView
+ *
+ * \tparam T JNI element type
+ * \tparam TAccess Policy for acquiring and releasing elements (static Acquire() and Release() functions)
+ */
+template <typename T, typename TAccess>
+class tArrayViewBase : private rrlib::util::tNoncopyable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! Java array type */
+  typedef typename tPrimitiveArrayTraits<T>::tArray tArray;
+
+  typedef T* iterator;
+  typedef const T* const_iterator;
+
+  ~tArrayViewBase()
+  {
+    Commit();
+  }
+
+  /*! Releases elements - discarding any modifications (if elements are a copy) */
+  void Abort()
+  {
+    Release(JNI_ABORT);
+  }
+
+  /*! Releases elements - writing back any modifications (if elements are a copy) */
+  void Commit()
+  {
+    Release(0);
+  }
+
+  /*! \return Pointer to array elements (NULL after release) */
+  T* Data()
+  {
+    return elements;
+  }
+  const T* Data() const
+  {
+    return elements;
+  }
+
+  /*! \return Whether elements are a copy of the Java array (instead of pinned Java array) */
+  bool IsCopy() const
+  {
+    return is_copy;
+  }
+
+  /*! \return Number of elements in array */
+  size_t Size() const
+  {
+    return size;
+  }
+
+  /*! \return Copy of elements (empty after release) */
+  std::vector<T> ToVector() const
+  {
+    return std::vector<T>(begin(), end());
+  }
+
+  T& operator[](size_t index)
+  {
+    assert(index < size && elements != NULL);
+    return elements[index];
+  }
+  const T& operator[](size_t index) const
+  {
+    assert(index < size && elements != NULL);
+    return elements[index];
+  }
+
+  iterator begin()
+  {
+    return elements;
+  }
+  const_iterator begin() const
+  {
+    return elements;
+  }
+  iterator end()
+  {
+    return elements != NULL ? elements + size : elements;
+  }
+  const_iterator end() const
+  {
+    return elements != NULL ? elements + size : elements;
+  }
+
+//----------------------------------------------------------------------
+// Protected methods
+//----------------------------------------------------------------------
+protected:
+
+  tArrayViewBase(tArray array, JNIEnv* env) :
+    env(env),
+    array(array),
+    size(env->GetArrayLength(array)),
+    is_copy(JNI_FALSE),
+    elements(TAccess::Acquire(env, array, &is_copy))
+  {
+    assert(elements != NULL && "OutOfMemoryError");
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! JNIEnv of thread that created view */
+  JNIEnv* const env;
+
+  /*! Java array */
+  const tArray array;
+
+  /*! Number of elements in array */
+  const size_t size;
+
+  /*! Whether elements are a copy */
+  jboolean is_copy;
+
+  /*! Pointer to array elements - NULL after release */
+  T* elements;
+
+  void Release(jint mode)
+  {
+    if (elements != NULL)
+    {
+      TAccess::Release(env, array, elements, mode);
+      elements = NULL;
+    }
+  }
+};
+
+}
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! View on Java primitive array
+/*!
+ * Provides pointer access to the elements of a Java primitive array.
+ * Depending on the Java VM, elements are either pinned or copied.
+ * Modifications are written back when the view is released with Commit()
+ * (which the destructor does by default) and discarded with Abort().
+ *
+ * \tparam T JNI element type (jboolean, jbyte, jchar, jshort, jint, jlong, jfloat or jdouble)
+ */
+template <typename T>
+class tArrayView : public internal::tArrayViewBase<T, internal::tArrayElementsAccess<T>>
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! Java array type */
+  typedef typename internal::tPrimitiveArrayTraits<T>::tArray tArray;
+
+  /*!
+   * \param array Java array to access
+   * \param env JNIEnv of current thread
+   */
+  explicit tArrayView(tArray array, JNIEnv* env = GetEnv()) :
+    internal::tArrayViewBase<T, internal::tArrayElementsAccess<T>>(array, env)
+  {}
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
@@ -0,0 +1,239 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/jni/tBoundedQueue.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-17
+ *
+ * \brief   Contains tBoundedQueue
+ *
+ * \b tBoundedQueue
+ *
+ * Bounded lock-free multi-producer/multi-consumer queue.
+ * Enqueueing and dequeueing never block, allocate, or make system calls -
+ * so this queue may be used by real-time threads to hand work over to
+ * background threads (e.g. threads attached to the Java VM).
+ *
+ * Based on the well-known array-based design by Dmitry Vyukov:
+ * each cell carries a sequence number that tells producers and consumers
+ * whether the cell may be written or read in the current lap.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__jni__tBoundedQueue_h__
+#define __rrlib__jni__tBoundedQueue_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/util/tNoncopyable.h"
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <stdint.h>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace jni
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Bounded lock-free queue
+/*!
+ * Bounded lock-free multi-producer/multi-consumer FIFO queue.
+ *
+ * \tparam T Type of queue elements (must be default-constructible and copyable)
+ */
+template <typename T>
+class tBoundedQueue : private rrlib::util::tNoncopyable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! \param capacity Maximum number of elements in queue (rounded up to a power of two) */
+  explicit tBoundedQueue(size_t capacity) :
+    mask(RoundUpToPowerOfTwo(capacity) - 1),
+    cells(new tCell[mask + 1]),
+    enqueue_position(0),
+    dequeue_position(0)
+  {
+    for (size_t i = 0; i <= mask; i++)
+    {
+      cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  /*! \return Maximum number of elements in queue */
+  size_t GetCapacity() const
+  {
+    return mask + 1;
+  }
+
+  /*! \return Number of elements in queue (approximate if queue is used concurrently) */
+  size_t GetSize() const
+  {
+    size_t enqueued = enqueue_position.load(std::memory_order_relaxed);
+    size_t dequeued = dequeue_position.load(std::memory_order_relaxed);
+    return enqueued >= dequeued ? enqueued - dequeued : 0;
+  }
+
+  /*!
+   * \param result Receives dequeued element
+   * \return False if queue is empty
+   */
+  bool TryDequeue(T& result)
+  {
+    size_t position = dequeue_position.load(std::memory_order_relaxed);
+    while (true)
+    {
+      tCell& cell = cells[position & mask];
+      size_t sequence = cell.sequence.load(std::memory_order_acquire);
+      intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1);
+      if (difference == 0)
+      {
+        if (dequeue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+        {
+          result = cell.value;
+          cell.sequence.store(position + mask + 1, std::memory_order_release);
+          return true;
+        }
+      }
+      else if (difference < 0)
+      {
+        return false;
+      }
+      else
+      {
+        position = dequeue_position.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  /*!
+   * \param element Element to enqueue
+   * \return False if queue is full
+   */
+  bool TryEnqueue(const T& element)
+  {
+    size_t position = enqueue_position.load(std::memory_order_relaxed);
+    while (true)
+    {
+      tCell& cell = cells[position & mask];
+      size_t sequence = cell.sequence.load(std::memory_order_acquire);
+      intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+      if (difference == 0)
+      {
+        if (enqueue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+        {
+          cell.value = element;
+          cell.sequence.store(position + 1, std::memory_order_release);
+          return true;
+        }
+      }
+      else if (difference < 0)
+      {
+        return false;
+      }
+      else
+      {
+        position = enqueue_position.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  enum { cCACHE_LINE_SIZE = 64 };
+
+  /*! Queue cell */
+  struct tCell
+  {
+    /*! Sequence number: equals position if cell may be written, position + 1 if it may be read */
+    std::atomic<size_t> sequence;
+
+    /*! Element stored in cell */
+    T value;
+  };
+
+  /*! Capacity - 1 */
+  const size_t mask;
+
+  /*! Queue cells */
+  std::unique_ptr<tCell[]> cells;
+
+  char padding1[cCACHE_LINE_SIZE];
+
+  /*! Position of next element to enqueue */
+  std::atomic<size_t> enqueue_position;
+
+  char padding2[cCACHE_LINE_SIZE - sizeof(std::atomic<size_t>)];
+
+  /*! Position of next element to dequeue */
+  std::atomic<size_t> dequeue_position;
+
+  char padding3[cCACHE_LINE_SIZE - sizeof(std::atomic<size_t>)];
+
+  static size_t RoundUpToPowerOfTwo(size_t capacity)
+  {
+    assert(capacity > 0);
+    size_t result = 1;
+    while (result < capacity)
+    {
+      result <<= 1;
+    }
+    return result;
+  }
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
@@ -0,0 +1,128 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/jni/tCriticalArrayView.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-17
+ *
+ * \brief   Contains tCriticalArrayView
+ *
+ * \b tCriticalArrayView
+ *
+ * Provides direct access to the elements of a Java primitive array
+ * (via GetPrimitiveArrayCritical) - usually without copying.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__jni__tCriticalArrayView_h__
+#define __rrlib__jni__tCriticalArrayView_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/jni/tArrayView.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace jni
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+namespace internal
+{
+
+/*! Acquires and releases elements via GetPrimitiveArrayCritical / ReleasePrimitiveArrayCritical */
+template <typename T>
+struct tCriticalAccess
+{
+  typedef typename tPrimitiveArrayTraits<T>::tArray tArray;
+  static T* Acquire(JNIEnv* env, tArray array, jboolean* is_copy)
+  {
+    return static_cast<T*>(env->GetPrimitiveArrayCritical(array, is_copy));
+  }
+  static void Release(JNIEnv* env, tArray array, T* elements, jint mode)
+  {
+    env->ReleasePrimitiveArrayCritical(array, elements, mode);
+  }
+};
+
+}
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Critical view on Java primitive array
+/*!
+ * Provides direct pointer access to the elements of a Java primitive array.
+ * The Java VM usually pins the array instead of copying it (and may pause garbage collection meanwhile).
+ * Therefore, while the view exists, the thread must not call other JNI functions
+ * (apart from other critical functions) or block - and it should be released quickly.
+ * Modifications are written back with Commit() (which the destructor does by default)
+ * and discarded with Abort() - if elements are a copy.
+ *
+ * \tparam T JNI element type (jboolean, jbyte, jchar, jshort, jint, jlong, jfloat or jdouble)
+ */
+template <typename T>
+class tCriticalArrayView : public internal::tArrayViewBase<T, internal::tCriticalAccess<T>>
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! Java array type */
+  typedef typename internal::tPrimitiveArrayTraits<T>::tArray tArray;
+
+  /*!
+   * \param array Java array to access
+   * \param env JNIEnv of current thread
+   */
+  explicit tCriticalArrayView(tArray array, JNIEnv* env = GetEnv()) :
+    internal::tArrayViewBase<T, internal::tCriticalAccess<T>>(array, env)
+  {}
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
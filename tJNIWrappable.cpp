@@ -33,10 +33,17 @@
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
 #include "rrlib/thread/tLock.h"
+#include <atomic>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
 
 //----------------------------------------------------------------------
 // Internal includes with ""
 //----------------------------------------------------------------------
+#include "rrlib/jni/class_loader.h"
+#include "rrlib/jni/tLocalFrame.h"
 
 //----------------------------------------------------------------------
 // Debugging
@@ -67,8 +74,161 @@ namespace jni
 // Implementation
 //----------------------------------------------------------------------
 
-/*! Mutex for creating Java objects - non-static would be faster at creation, but would consume more memory */
-rrlib::thread::tMutex tJNIWrappable::create_mutex;
+namespace
+{
+
+/*!
+ * Cached Java class and constructor for one wrapper class name.
+ * Entries are only appended to the list and never deleted, so the list can be traversed without locking.
+ */
+struct tWrapperClass
+{
+  /*! Fully-qualified name of Java class */
+  const std::string name;
+
+  /*! Global reference to Java class - NULL if not resolved (yet) or invalidated */
+  std::atomic<jclass> clazz;
+
+  /*! Constructor taking long argument (pointer) - valid if clazz is not NULL */
+  std::atomic<jmethodID> constructor;
+
+  /*! Next entry in list */
+  tWrapperClass* const next;
+
+  tWrapperClass(const char* name, tWrapperClass* next) :
+    name(name),
+    clazz(NULL),
+    constructor(NULL),
+    next(next)
+  {}
+};
+
+/*! Head of list with cached wrapper classes */
+std::atomic<tWrapperClass*> wrapper_class_list(NULL);
+
+/*! Mutex for adding entries to wrapper class list and invalidating them (classes are resolved without holding it) */
+rrlib::thread::tMutex wrapper_class_mutex;
+
+tWrapperClass* FindWrapperClass(const char* class_name)
+{
+  for (tWrapperClass* entry = wrapper_class_list.load(std::memory_order_acquire); entry != NULL; entry = entry->next)
+  {
+    if (strcmp(entry->name.c_str(), class_name) == 0)
+    {
+      return entry;
+    }
+  }
+  return NULL;
+}
+
+/*!
+ * Looks up Java class and constructor for wrapper class with specified name.
+ * Lookup is only performed once per class name - afterwards cached values are returned without locking.
+ *
+ * \return Whether lookup succeeded (otherwise, clazz is NULL and a Java exception is pending)
+ */
+bool GetWrapperClass(JNIEnv* env, const char* class_name, jclass& clazz, jmethodID& constructor)
+{
+  tWrapperClass* entry = FindWrapperClass(class_name);
+  if (entry != NULL)
+  {
+    clazz = entry->clazz.load(std::memory_order_acquire);
+    if (clazz != NULL)
+    {
+      constructor = entry->constructor.load(std::memory_order_relaxed);
+      return true;
+    }
+  }
+
+  // Resolve class without holding lock: loading and initializing class may run Java code (e.g. a static initializer creating wrappers)
+  jclass cached_class = FindClass(class_name, env);
+  if (cached_class == NULL)
+  {
+    return false; // class not found
+  }
+
+  /* Get the method ID for the clazz(long) constructor */
+  jmethodID cid = env->GetMethodID(cached_class, "<init>", "(J)V");
+  if (cid == NULL)
+  {
+    return false; // no constructor taking long argument (pointer)
+  }
+  jclass global_class = static_cast<jclass>(env->NewGlobalRef(cached_class));
+
+  if (entry == NULL)
+  {
+    rrlib::thread::tLock l(wrapper_class_mutex);
+    entry = FindWrapperClass(class_name);
+    if (entry == NULL)
+    {
+      entry = new tWrapperClass(class_name, wrapper_class_list.load(std::memory_order_relaxed));
+      wrapper_class_list.store(entry, std::memory_order_release);
+    }
+  }
+  entry->constructor.store(cid, std::memory_order_relaxed); // same value if another thread resolved class concurrently
+  jclass expected = NULL;
+  if (entry->clazz.compare_exchange_strong(expected, global_class, std::memory_order_acq_rel))
+  {
+    clazz = global_class;
+  }
+  else
+  {
+    env->DeleteGlobalRef(global_class); // other thread was faster
+    clazz = expected;
+  }
+  constructor = cid;
+  return true;
+}
+
+/*!
+ * Wrapper class resolved during GetJavaWrappers() for a group of objects with the same class name.
+ * Set while the wrappers of this group are created - so that the default implementation of
+ * CreateJavaWrapper() looks up class and constructor only once per group (not once per object).
+ */
+struct tResolvedWrapperClass
+{
+  /*! Fully-qualified name of Java class (as returned by GetJavaClassName()) */
+  const char* name;
+
+  /*! Global reference to Java class - NULL if not resolved yet */
+  jclass clazz;
+
+  /*! Constructor taking long argument (pointer) */
+  jmethodID constructor;
+};
+
+/*! Wrapper class of group whose wrappers are currently created by GetJavaWrappers() in this thread (NULL if none) */
+__thread tResolvedWrapperClass* current_wrapper_class = NULL;
+
+/*! Objects without Java wrapper that return the same class name (indices in objects array passed to GetJavaWrappers()) */
+struct tWrapperGroup
+{
+  const char* class_name;
+  std::vector<size_t> indices;
+};
+
+}
+
+namespace internal
+{
+
+void ClearWrapperClassCache(JNIEnv* env)
+{
+  rrlib::thread::tLock l(wrapper_class_mutex);
+  for (tWrapperClass* entry = wrapper_class_list.load(std::memory_order_relaxed); entry != NULL; entry = entry->next)
+  {
+    jclass clazz = entry->clazz.exchange(NULL);
+    if (clazz != NULL)
+    {
+      env->DeleteGlobalRef(clazz);
+    }
+  }
+}
+
+} // namespace internal
+
+const size_t tJNIWrappable::cCREATE_MUTEX_COUNT;
+tJNIWrappable::tCreateMutex tJNIWrappable::create_mutexes[cCREATE_MUTEX_COUNT];
 
 tJNIWrappable::tJNIWrappable() :
   java_wrapper_object()
@@ -79,33 +239,124 @@ tJNIWrappable::~tJNIWrappable()
 
 jobject tJNIWrappable::CreateJavaWrapper()
 {
-  rrlib::thread::tLock l(create_mutex); // avoid that two threads create wrapper object at the same time
+  JNIEnv* env = GetEnv();
+  const char* class_name = GetJavaClassName();
+  assert(class_name != NULL && "Cannot create java class without class name - your class needs to override getJavaClassName()");
+  tResolvedWrapperClass* resolved = current_wrapper_class;
+  if (resolved != NULL && (resolved->name == class_name || strcmp(resolved->name, class_name) == 0))
+  {
+    if (resolved->clazz == NULL && !GetWrapperClass(env, class_name, resolved->clazz, resolved->constructor))
+    {
+      return NULL;
+    }
+    return NewJavaWrapper(env, resolved->clazz, resolved->constructor);
+  }
+
+  jclass clazz = NULL;
+  jmethodID cid = NULL;
+  if (!GetWrapperClass(env, class_name, clazz, cid))
+  {
+    return NULL;
+  }
+  return NewJavaWrapper(env, clazz, cid);
+}
+
+jobjectArray tJNIWrappable::GetJavaWrappers(tJNIWrappable* const* objects, size_t count, JNIEnv* env)
+{
+  if (count > static_cast<size_t>(std::numeric_limits<jsize>::max()))
+  {
+    jclass exception_class = FindClass("java/lang/IllegalArgumentException", env);
+    if (exception_class)
+    {
+      env->ThrowNew(exception_class, "Too many objects for a Java array");
+    }
+    return NULL;
+  }
+
+  tLocalFrame frame(16, env);
+  jclass object_class = FindClass("java/lang/Object", env);
+  jobjectArray result = object_class ? env->NewObjectArray(static_cast<jsize>(count), object_class, NULL) : NULL;
+  if (result == NULL)
+  {
+    return NULL;
+  }
+
+  // Set existing wrappers and group objects without wrapper by class name
+  std::vector<tWrapperGroup> groups;
+  for (size_t i = 0; i < count; i++)
+  {
+    tJNIWrappable* object = objects[i];
+    if (object == NULL)
+    {
+      continue;
+    }
+    jobject wrapper = object->java_wrapper_object.Get();
+    if (wrapper != NULL)
+    {
+      env->SetObjectArrayElement(result, static_cast<jsize>(i), wrapper);
+      continue;
+    }
+    const char* class_name = object->GetJavaClassName();
+    tWrapperGroup* group = NULL;
+    for (auto it = groups.rbegin(); it != groups.rend(); ++it) // objects of the same class usually return the same string literal
+    {
+      if (it->class_name == class_name || (it->class_name && class_name && strcmp(it->class_name, class_name) == 0))
+      {
+        group = &(*it);
+        break;
+      }
+    }
+    if (group == NULL)
+    {
+      groups.push_back(tWrapperGroup { class_name, std::vector<size_t>() });
+      group = &groups.back();
+    }
+    group->indices.push_back(i);
+  }
+
+  // Create missing wrappers via (virtual) CreateJavaWrapper() - the default implementation resolves class and constructor once per group
+  tResolvedWrapperClass* outer_wrapper_class = current_wrapper_class; // GetJavaWrappers() might be called from Java code run by a wrapper constructor
+  for (tWrapperGroup& group : groups)
+  {
+    tResolvedWrapperClass resolved = { group.class_name, NULL, NULL };
+    current_wrapper_class = group.class_name ? &resolved : NULL;
+    for (size_t i : group.indices)
+    {
+      jobject wrapper = objects[i]->CreateJavaWrapper();
+      if (wrapper == NULL)
+      {
+        current_wrapper_class = outer_wrapper_class;
+        return NULL; // creating wrapper failed - Java exception is pending
+      }
+      env->SetObjectArrayElement(result, static_cast<jsize>(i), wrapper);
+    }
+  }
+  current_wrapper_class = outer_wrapper_class;
+  return frame.Pop(result);
+}
+
+jobject tJNIWrappable::NewJavaWrapper(JNIEnv* env, jclass clazz, jmethodID constructor)
+{
+  rrlib::thread::tLock l(GetCreateMutex()); // avoid that two threads create wrapper object at the same time
   jobject obj = java_wrapper_object.Get();
   if (obj != NULL)   // "double-checked locking" - should be safe though
   {
     return obj;
   }
-  JNIEnv* env = GetEnv();
-  __attribute__((unused)) // prevents warning in release mode
-  const char* class_name = GetJavaClassName();
-  assert(class_name != NULL && "Cannot create java class without class name - your class needs to override getJavaClassName()");
-  jclass clazz = env->FindClass(GetJavaClassName());
-  assert(clazz != NULL && "Class not found");
-
-  /* Get the method ID for the clazz(long) constructor */
-  jmethodID cid = env->GetMethodID(clazz, "<init>", "(L)V");
-  assert(cid != NULL && "No Constructor taking long argument (pointer) found for Java class");
 
-  obj = env->NewObject(clazz, cid, (jlong)this);
-  assert(obj != NULL && "Java object creation failed for whatever reason");
+  obj = env->NewObject(clazz, constructor, (jlong)this);
+  if (obj == NULL)
+  {
+    return NULL; // Java exception is pending (e.g. OutOfMemoryError or exception thrown by constructor)
+  }
+  RRLIB_JNI_COUNT(WRAPPER_CREATED);
   java_wrapper_object.Set(obj, true);
-  env->DeleteLocalRef(clazz);
-  return obj;
+  return java_wrapper_object.Get();
 }
 
 void tJNIWrappable::SetJavaWrapper(jobject obj, bool cpp_responsible_)
 {
-  rrlib::thread::tLock l(create_mutex); // avoid that two threads create wrapper object at the same time
+  rrlib::thread::tLock l(GetCreateMutex()); // avoid that two threads create wrapper object at the same time
   if (java_wrapper_object.Get() == obj)
   {
     return;
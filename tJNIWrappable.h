@@ -58,6 +58,17 @@ namespace jni
 // Forward declarations / typedefs / enums
 //----------------------------------------------------------------------
 
+namespace internal
+{
+
+/*!
+ * Releases cached Java classes and constructors of wrapper classes (e.g. when library or classes are unloaded).
+ * Must not be called while Java wrappers are created concurrently.
+ */
+void ClearWrapperClassCache(JNIEnv* env);
+
+}
+
 //----------------------------------------------------------------------
 // Class declaration
 //----------------------------------------------------------------------
@@ -77,7 +88,7 @@ public:
 
   virtual ~tJNIWrappable();
 
-  /*! Get Java Wrapper for this object */
+  /*! Get Java Wrapper for this object (NULL if creating it failed - then, a Java exception is pending) */
   jobject GetJavaWrapper()
   {
     jobject obj = java_wrapper_object.Get();
@@ -88,6 +99,22 @@ public:
     return CreateJavaWrapper();
   }
 
+  /*!
+   * Get Java Wrappers for several objects - creating all missing wrappers in one bulk operation.
+   * Missing wrappers are created via CreateJavaWrapper() (so overrides are respected) - all in a single local frame.
+   * Objects are grouped by GetJavaClassName(), so that the default implementation looks up wrapper class
+   * and constructor only once per class.
+   *
+   * \param objects Objects to get Java wrappers for (NULL entries result in NULL array elements)
+   * \param count Number of objects
+   * \param env JNIEnv of current thread
+   * \return Local reference to Java Object[] containing wrappers (in same order as objects).
+   *         NULL if count exceeds maximum Java array length (IllegalArgumentException), array could not be allocated
+   *         or creating a wrapper failed - then, a Java exception is pending
+   *         (wrappers created before the failure remain set).
+   */
+  static jobjectArray GetJavaWrappers(tJNIWrappable* const* objects, size_t count, JNIEnv* env = GetEnv());
+
   /*! Set Java Wrapper for this object - once set, may not be changed to a different instance */
   void SetJavaWrapper(jobject obj, bool cpp_responsible_);
 
@@ -99,7 +126,7 @@ protected:
   /*! Returns fully-qualified name of Java-(Wrapper)-Class name */
   virtual const char* GetJavaClassName() const;
 
-  /** Creates Java Wrapper object from c++ side */
+  /** Creates Java Wrapper object from c++ side (returns NULL if this fails - then, a Java exception is pending) */
   virtual jobject CreateJavaWrapper();
 
 //----------------------------------------------------------------------
@@ -110,8 +137,36 @@ private:
   /*! Java Object that wraps this object. Null, if there isn't any wrapper (yet) */
   tJavaObjectReference java_wrapper_object;
 
-  /*! Mutex for creating Java objects - non-static would be faster at creation, but would consume more memory */
-  static rrlib::thread::tMutex create_mutex;
+  /*! Number of mutexes for creating Java objects */
+  static const size_t cCREATE_MUTEX_COUNT = 64;
+
+  /*! Mutex for creating Java objects - padded to avoid false sharing between stripes */
+  struct alignas(64) tCreateMutex
+  {
+    rrlib::thread::tMutex mutex;
+  };
+
+  /*!
+   * Mutexes for creating Java objects - each object uses the one selected by its address.
+   * Non-static would be faster at creation, but would consume more memory.
+   */
+  static tCreateMutex create_mutexes[cCREATE_MUTEX_COUNT];
+
+  /*! \return Mutex for creating Java wrapper of this object */
+  rrlib::thread::tMutex& GetCreateMutex() const
+  {
+    size_t address = reinterpret_cast<size_t>(this);
+    return create_mutexes[((address >> 4) ^ (address >> 10)) % cCREATE_MUTEX_COUNT].mutex;
+  }
+
+  /*!
+   * Creates Java wrapper of specified class for this object - unless another thread was faster
+   *
+   * \param clazz Global reference to Java class of wrapper
+   * \param constructor Constructor of Java class taking long argument (pointer)
+   * \return Java wrapper of this object (NULL if creating it failed - then, a Java exception is pending)
+   */
+  jobject NewJavaWrapper(JNIEnv* env, jclass clazz, jmethodID constructor);
 
 };
 
@@ -0,0 +1,250 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/jni/tJavaCallbackExecutor.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-17
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/jni/tJavaCallbackExecutor.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cerrno>
+#include <chrono>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/jni/tLocalFrame.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace jni
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+namespace
+{
+
+/*! \return Current time of steady clock in nanoseconds */
+inline int64_t Now()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/*! Raises atomic maximum to value (if it is larger) */
+template <typename T>
+inline void UpdateMaximum(std::atomic<T>& maximum, T value)
+{
+  T current = maximum.load(std::memory_order_relaxed);
+  while (value > current && (!maximum.compare_exchange_weak(current, value, std::memory_order_relaxed)))
+  {}
+}
+
+/*! Prints and clears Java exception left pending by callback */
+inline void HandlePendingException(JNIEnv* env)
+{
+  if (env->ExceptionCheck())
+  {
+    env->ExceptionDescribe();
+    env->ExceptionClear();
+  }
+}
+
+}
+
+tJavaCallbackExecutor::tJavaCallbackExecutor(size_t thread_count, size_t queue_capacity, size_t max_batch_size) :
+  max_batch_size(max_batch_size),
+  queue(queue_capacity),
+  job_semaphore(),
+  running(true),
+  workers(),
+  executed_jobs(0),
+  callback_invocations(0),
+  rejected_jobs(0),
+  total_latency_ns(0),
+  max_latency_ns(0),
+  max_queue_depth(0)
+{
+  assert(thread_count > 0 && max_batch_size > 0);
+  __attribute__((unused)) // prevents warning in release mode
+  int res = sem_init(&job_semaphore, 0, 0);
+  assert(res == 0 && "Could not initialize semaphore");
+
+  std::atomic<size_t> attached_workers(0);
+  for (size_t i = 0; i < thread_count; i++)
+  {
+    workers.emplace_back(&tJavaCallbackExecutor::RunWorker, this, &attached_workers);
+  }
+  while (attached_workers.load(std::memory_order_acquire) < thread_count)
+  {
+    std::this_thread::yield();
+  }
+}
+
+tJavaCallbackExecutor::~tJavaCallbackExecutor()
+{
+  running.store(false, std::memory_order_release);
+  for (size_t i = 0; i < workers.size(); i++)
+  {
+    sem_post(&job_semaphore);
+  }
+  for (std::thread & worker : workers)
+  {
+    worker.join();
+  }
+  sem_destroy(&job_semaphore);
+}
+
+bool tJavaCallbackExecutor::Enqueue(tJob job)
+{
+  job.enqueue_time = Now();
+  if (!queue.TryEnqueue(job))
+  {
+    rejected_jobs.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+  UpdateMaximum(max_queue_depth, queue.GetSize());
+  sem_post(&job_semaphore);
+  return true;
+}
+
+tJavaCallbackExecutor::tJob tJavaCallbackExecutor::ExecuteJobs(JNIEnv* env, const tJob& first_job, std::vector<void*>& batch_arguments)
+{
+  tLocalFrame frame(16, env);
+  int64_t start_time = Now();
+  uint64_t latency_sum = start_time - first_job.enqueue_time;
+  UpdateMaximum<uint64_t>(max_latency_ns, latency_sum);
+
+  if (first_job.callback)
+  {
+    first_job.callback(env, first_job.argument);
+    HandlePendingException(env);
+    executed_jobs.fetch_add(1, std::memory_order_relaxed);
+    callback_invocations.fetch_add(1, std::memory_order_relaxed);
+    total_latency_ns.fetch_add(latency_sum, std::memory_order_relaxed);
+    return tJob();
+  }
+
+  // Coalesce subsequent jobs with same batch callback
+  tJob next_job, remaining_job;
+  batch_arguments.clear();
+  batch_arguments.push_back(first_job.argument);
+  while (batch_arguments.size() < max_batch_size && queue.TryDequeue(next_job))
+  {
+    if (next_job.batch_callback != first_job.batch_callback)
+    {
+      remaining_job = next_job;
+      break;
+    }
+    uint64_t latency = start_time - next_job.enqueue_time;
+    UpdateMaximum(max_latency_ns, latency);
+    latency_sum += latency;
+    batch_arguments.push_back(next_job.argument);
+  }
+
+  first_job.batch_callback(env, batch_arguments.data(), batch_arguments.size());
+  HandlePendingException(env);
+  executed_jobs.fetch_add(batch_arguments.size(), std::memory_order_relaxed);
+  callback_invocations.fetch_add(1, std::memory_order_relaxed);
+  total_latency_ns.fetch_add(latency_sum, std::memory_order_relaxed);
+  return remaining_job;
+}
+
+tJavaCallbackExecutor::tStatistics tJavaCallbackExecutor::GetStatistics() const
+{
+  tStatistics result;
+  result.executed_jobs = executed_jobs.load(std::memory_order_relaxed);
+  result.callback_invocations = callback_invocations.load(std::memory_order_relaxed);
+  result.rejected_jobs = rejected_jobs.load(std::memory_order_relaxed);
+  result.total_latency_ns = total_latency_ns.load(std::memory_order_relaxed);
+  result.max_latency_ns = max_latency_ns.load(std::memory_order_relaxed);
+  result.max_queue_depth = max_queue_depth.load(std::memory_order_relaxed);
+  return result;
+}
+
+void tJavaCallbackExecutor::ResetStatistics()
+{
+  executed_jobs.store(0, std::memory_order_relaxed);
+  callback_invocations.store(0, std::memory_order_relaxed);
+  rejected_jobs.store(0, std::memory_order_relaxed);
+  total_latency_ns.store(0, std::memory_order_relaxed);
+  max_latency_ns.store(0, std::memory_order_relaxed);
+  max_queue_depth.store(0, std::memory_order_relaxed);
+}
+
+void tJavaCallbackExecutor::RunWorker(std::atomic<size_t>* attached_workers)
+{
+  JNIEnv* env = internal::AttachThread(true);
+  attached_workers->fetch_add(1, std::memory_order_release); // must not be accessed afterwards
+
+  std::vector<void*> batch_arguments;
+  batch_arguments.reserve(max_batch_size);
+  tJob job;
+  while (true)
+  {
+    if (job.callback == NULL && job.batch_callback == NULL && (!queue.TryDequeue(job)))
+    {
+      if (!running.load(std::memory_order_acquire))
+      {
+        break;
+      }
+      while (sem_wait(&job_semaphore) != 0 && errno == EINTR)
+      {}
+      continue;
+    }
+    job = ExecuteJobs(env, job, batch_arguments);
+  }
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
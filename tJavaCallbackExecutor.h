@@ -0,0 +1,243 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/jni/tJavaCallbackExecutor.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-17
+ *
+ * \brief   Contains tJavaCallbackExecutor
+ *
+ * \b tJavaCallbackExecutor
+ *
+ * Pool of threads - attached to the Java VM on construction - that execute
+ * callbacks (typically calls into Java) on behalf of other threads.
+ *
+ * Real-time threads can thereby trigger Java code without entering the
+ * Java VM themselves (and possibly blocking at a safepoint): jobs are
+ * passed via a bounded lock-free queue. Enqueueing never blocks or
+ * allocates memory - a worker is woken via a semaphore.
+ *
+ * Several pending jobs with the same batch callback can be coalesced
+ * into a single (batched) call.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__jni__tJavaCallbackExecutor_h__
+#define __rrlib__jni__tJavaCallbackExecutor_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/util/tNoncopyable.h"
+#include <atomic>
+#include <semaphore.h>
+#include <stdint.h>
+#include <thread>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/jni/jvm.h"
+#include "rrlib/jni/tBoundedQueue.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace jni
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Executor for (Java) callbacks on pre-attached threads
+/*!
+ * Executes callbacks on a fixed pool of threads attached to the Java VM (as daemon threads).
+ * Each callback invocation (or batch) runs inside its own local frame -
+ * so callbacks need not delete local references they create.
+ * Java exceptions left pending by callbacks are printed and cleared.
+ *
+ * Execute() and ExecuteBatched() are lock-free and may be called from any thread
+ * (including real-time threads never attached to the Java VM).
+ */
+class tJavaCallbackExecutor : private rrlib::util::tNoncopyable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! Callback for single jobs */
+  typedef void (*tCallback)(JNIEnv* env, void* argument);
+
+  /*! Callback for batched jobs - receives arguments of all coalesced jobs */
+  typedef void (*tBatchCallback)(JNIEnv* env, void* const* arguments, size_t count);
+
+  /*! Executor statistics */
+  struct tStatistics
+  {
+    /*! Number of jobs executed */
+    uint64_t executed_jobs;
+
+    /*! Number of callback invocations (smaller than executed_jobs if jobs were coalesced) */
+    uint64_t callback_invocations;
+
+    /*! Number of jobs rejected as queue was full */
+    uint64_t rejected_jobs;
+
+    /*! Sum and maximum of times between enqueueing and start of execution of jobs (in nanoseconds) */
+    uint64_t total_latency_ns, max_latency_ns;
+
+    /*! Maximum number of jobs pending in queue */
+    size_t max_queue_depth;
+
+    /*! \return Average time between enqueueing and start of execution of jobs (in nanoseconds) */
+    double GetAverageLatencyNs() const
+    {
+      return executed_jobs ? static_cast<double>(total_latency_ns) / executed_jobs : 0.0;
+    }
+  };
+
+  /*!
+   * Starts worker threads and returns after all of them are attached to the Java VM
+   *
+   * \param thread_count Number of worker threads
+   * \param queue_capacity Maximum number of pending jobs (rounded up to a power of two)
+   * \param max_batch_size Maximum number of jobs coalesced into one batched call (1 disables coalescing)
+   */
+  explicit tJavaCallbackExecutor(size_t thread_count = 1, size_t queue_capacity = 4096, size_t max_batch_size = 64);
+
+  /*! Executes all pending jobs and stops worker threads */
+  ~tJavaCallbackExecutor();
+
+  /*!
+   * Enqueues job for execution on a worker thread
+   *
+   * \param callback Callback to execute
+   * \param argument Argument passed to callback
+   * \return False if queue is full (job is rejected)
+   */
+  bool Execute(tCallback callback, void* argument)
+  {
+    return Enqueue(tJob(callback, NULL, argument));
+  }
+
+  /*!
+   * Enqueues job for execution on a worker thread.
+   * Jobs pending for the same callback may be coalesced into a single call (in enqueueing order).
+   *
+   * \param callback Callback to execute
+   * \param argument Argument passed to callback (together with arguments of coalesced jobs)
+   * \return False if queue is full (job is rejected)
+   */
+  bool ExecuteBatched(tBatchCallback callback, void* argument)
+  {
+    return Enqueue(tJob(NULL, callback, argument));
+  }
+
+  /*! \return Number of currently pending jobs (approximate) */
+  size_t GetQueueDepth() const
+  {
+    return queue.GetSize();
+  }
+
+  /*! \return Snapshot of executor statistics */
+  tStatistics GetStatistics() const;
+
+  /*! Resets executor statistics */
+  void ResetStatistics();
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Job in queue */
+  struct tJob
+  {
+    tCallback callback;
+    tBatchCallback batch_callback;
+    void* argument;
+
+    /*! Time when job was enqueued (steady clock, in nanoseconds) */
+    int64_t enqueue_time;
+
+    tJob() :
+      callback(NULL),
+      batch_callback(NULL),
+      argument(NULL),
+      enqueue_time(0)
+    {}
+
+    tJob(tCallback callback, tBatchCallback batch_callback, void* argument) :
+      callback(callback),
+      batch_callback(batch_callback),
+      argument(argument),
+      enqueue_time(0)
+    {}
+  };
+
+  /*! Maximum number of jobs coalesced into one batched call */
+  const size_t max_batch_size;
+
+  /*! Pending jobs */
+  tBoundedQueue<tJob> queue;
+
+  /*! Counts pending jobs - workers wait on it */
+  sem_t job_semaphore;
+
+  /*! Set to false when executor is destructed */
+  std::atomic<bool> running;
+
+  /*! Worker threads */
+  std::vector<std::thread> workers;
+
+  /*! Statistics (see tStatistics) */
+  std::atomic<uint64_t> executed_jobs, callback_invocations, rejected_jobs, total_latency_ns, max_latency_ns;
+  std::atomic<size_t> max_queue_depth;
+
+  /*! Enqueues job and wakes up worker */
+  bool Enqueue(tJob job);
+
+  /*! Executes jobs starting with first_job - coalescing subsequent jobs if possible. \return Job that could not be coalesced (callbacks NULL if there is none) */
+  tJob ExecuteJobs(JNIEnv* env, const tJob& first_job, std::vector<void*>& batch_arguments);
+
+  /*! Main loop of worker threads */
+  void RunWorker(std::atomic<size_t>* attached_workers);
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
@@ -0,0 +1,125 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/jni/tJavaClass.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-17
+ *
+ * \brief   Contains tJavaClass
+ *
+ * \b tJavaClass
+ *
+ * Java class that is looked up by name on first use.
+ * Afterwards, a global reference to the class is kept.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__jni__tJavaClass_h__
+#define __rrlib__jni__tJavaClass_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/util/tNoncopyable.h"
+#include <atomic>
+#include <string>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/jni/jvm.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace jni
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Lazily resolved Java class
+/*!
+ * Java class that is looked up by name on first use.
+ * Afterwards, the global reference from the class cache (see FindClass()) is kept.
+ * It is owned by the class cache and only released when the library is unloaded.
+ * Hence, tJavaClass objects (typically static) need not delete any reference
+ * during static destruction - when the JVM may already be gone.
+ * Thread-safe.
+ */
+class tJavaClass : private rrlib::util::tNoncopyable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! \param name Fully-qualified name of Java class (e.g. "org/rrlib/jni/JNICalls") */
+  explicit tJavaClass(const char* name);
+
+  /*!
+   * \param env JNIEnv of current thread
+   * \return Global reference to Java class (NULL if class could not be found - then, an exception is pending)
+   */
+  jclass Get(JNIEnv* env = GetEnv()) const
+  {
+    jclass result = clazz.load(std::memory_order_acquire);
+    return result != NULL ? result : Resolve(env);
+  }
+
+  /*! \return Fully-qualified name of Java class */
+  const std::string& GetName() const
+  {
+    return name;
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Fully-qualified name of Java class */
+  const std::string name;
+
+  /*! Global reference to Java class - NULL if not resolved yet */
+  mutable std::atomic<jclass> clazz;
+
+  /*! Looks up Java class */
+  jclass Resolve(JNIEnv* env) const;
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
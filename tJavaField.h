@@ -0,0 +1,202 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/jni/tJavaField.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-17
+ *
+ * \brief   Contains tJavaField and tJavaStaticField
+ *
+ * \b tJavaField
+ *
+ * Field of Java objects that can be read and written from C++.
+ * The JNI type signature is derived from the C++ type
+ * and the field ID is looked up only once.
+ *
+ * Example:
+ *   static tJavaField<jdouble> x("org/example/Point", "x");
+ *   static tJavaField<jdouble> y("org/example/Point", "y");
+ *   std::tuple<jdouble, jdouble> xy = GetFields(point, x, y);
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__jni__tJavaField_h__
+#define __rrlib__jni__tJavaField_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <tuple>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/jni/tJavaMember.h"
+#include "rrlib/jni/type_traits.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace jni
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Java field
+/*!
+ * Field of Java objects that can be read and written with C++ type T (see tJNIType for supported types).
+ * Its JNI signature is derived from T - and its field ID is looked up once.
+ *
+ * \tparam T C++ type of field
+ */
+template <typename T>
+class tJavaField : public internal::tJavaMember<jfieldID>
+{
+  typedef tJNIType<T> tType;
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*!
+   * \param class_name Fully-qualified name of Java class (e.g. "org/example/Point")
+   * \param field_name Name of field
+   * \param signature JNI type signature - only needs to be specified if derived one is not appropriate
+   *                  (e.g. if field has a specific class type). Must remain valid.
+   */
+  tJavaField(const char* class_name, const char* field_name, const char* signature = tType::tSignature::value) :
+    tJavaMember(class_name, field_name, signature, false)
+  {}
+
+  /*!
+   * \param object Java object to read field of
+   * \param env JNIEnv of current thread
+   * \return Value of field
+   */
+  T Get(jobject object, JNIEnv* env = GetEnv()) const
+  {
+    return tType::FromJNI(env, tType::GetField(env, object, GetID(env)));
+  }
+
+  /*!
+   * \param object Java object to write field of
+   * \param value New value of field
+   * \param env JNIEnv of current thread
+   */
+  void Set(jobject object, const T& value, JNIEnv* env = GetEnv()) const
+  {
+    typename tType::tJNI jni_value = tType::ToJNI(env, value);
+    tType::SetField(env, object, GetID(env), jni_value);
+    tType::ReleaseJNI(env, tType::ToJvalue(jni_value));
+  }
+};
+
+//! Static Java field
+/*!
+ * Static field of a Java class that can be read and written with C++ type T (see tJNIType for supported types).
+ * Its JNI signature is derived from T - and its field ID is looked up once.
+ *
+ * \tparam T C++ type of field
+ */
+template <typename T>
+class tJavaStaticField : public internal::tJavaMember<jfieldID>
+{
+  typedef tJNIType<T> tType;
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*!
+   * \param class_name Fully-qualified name of Java class (e.g. "org/example/Config")
+   * \param field_name Name of field
+   * \param signature JNI type signature - only needs to be specified if derived one is not appropriate
+   *                  (e.g. if field has a specific class type). Must remain valid.
+   */
+  tJavaStaticField(const char* class_name, const char* field_name, const char* signature = tType::tSignature::value) :
+    tJavaMember(class_name, field_name, signature, true)
+  {}
+
+  /*!
+   * \param env JNIEnv of current thread
+   * \return Value of field
+   */
+  T Get(JNIEnv* env = GetEnv()) const
+  {
+    jfieldID field = GetID(env);
+    return tType::FromJNI(env, tType::GetStaticField(env, GetClass().Get(env), field));
+  }
+
+  /*!
+   * \param value New value of field
+   * \param env JNIEnv of current thread
+   */
+  void Set(const T& value, JNIEnv* env = GetEnv()) const
+  {
+    jfieldID field = GetID(env);
+    typename tType::tJNI jni_value = tType::ToJNI(env, value);
+    tType::SetStaticField(env, GetClass().Get(env), field, jni_value);
+    tType::ReleaseJNI(env, tType::ToJvalue(jni_value));
+  }
+};
+
+//----------------------------------------------------------------------
+// Function declarations
+//----------------------------------------------------------------------
+
+/*!
+ * Reads several fields of one Java object
+ *
+ * \param object Java object to read fields of
+ * \param fields Fields to read
+ * \return Values of fields (in the order fields were specified)
+ */
+template <typename ... T>
+inline std::tuple<T...> GetFields(jobject object, const tJavaField<T>& ... fields)
+{
+  JNIEnv* env = GetEnv();
+  return std::tuple<T...>(fields.Get(object, env)...);
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
@@ -0,0 +1,184 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/jni/tJavaMember.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-17
+ *
+ * \brief   Contains tJavaMember
+ *
+ * \b tJavaMember
+ *
+ * Common base of tJavaMethod/tJavaStaticMethod and tJavaField/tJavaStaticField:
+ * a member of a Java class whose ID is looked up on first use and cached afterwards.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__jni__tJavaMember_h__
+#define __rrlib__jni__tJavaMember_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/util/tNoncopyable.h"
+#include <atomic>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/jni/tJavaClass.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace jni
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+namespace internal
+{
+
+/*! Looks up IDs of Java class members of type TID (jmethodID or jfieldID) */
+template <typename TID>
+struct tMemberLookup;
+
+template <>
+struct tMemberLookup<jmethodID>
+{
+  static jmethodID Lookup(JNIEnv* env, jclass clazz, const char* name, const char* signature, bool is_static)
+  {
+    return is_static ? env->GetStaticMethodID(clazz, name, signature) : env->GetMethodID(clazz, name, signature);
+  }
+};
+
+template <>
+struct tMemberLookup<jfieldID>
+{
+  static jfieldID Lookup(JNIEnv* env, jclass clazz, const char* name, const char* signature, bool is_static)
+  {
+    return is_static ? env->GetStaticFieldID(clazz, name, signature) : env->GetFieldID(clazz, name, signature);
+  }
+};
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Member of Java class
+/*!
+ * Method or field of a Java class - looks up and caches its ID.
+ * Thread-safe.
+ *
+ * \tparam TID Type of member ID (jmethodID or jfieldID)
+ */
+template <typename TID>
+class tJavaMember : private rrlib::util::tNoncopyable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  tJavaMember(const char* class_name, const char* name, const char* signature, bool is_static) :
+    clazz(class_name),
+    name(name),
+    signature(signature),
+    is_static(is_static),
+    id(NULL)
+  {}
+
+  /*! \return Java class that member belongs to */
+  const tJavaClass& GetClass() const
+  {
+    return clazz;
+  }
+
+  /*!
+   * \param env JNIEnv of current thread
+   * \return Method or field ID (looked up on first call)
+   */
+  TID GetID(JNIEnv* env = GetEnv()) const
+  {
+    TID result = id.load(std::memory_order_acquire);
+    if (result == NULL)
+    {
+      jclass java_class = clazz.Get(env);
+      assert(java_class != NULL && "Class not found");
+      result = tMemberLookup<TID>::Lookup(env, java_class, name, signature, is_static);
+      assert(result != NULL && "Member not found");
+      id.store(result, std::memory_order_release);
+    }
+    return result;
+  }
+
+  /*! \return Name of member */
+  const char* GetName() const
+  {
+    return name;
+  }
+
+  /*! \return JNI type signature of member */
+  const char* GetSignature() const
+  {
+    return signature;
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Java class that member belongs to */
+  tJavaClass clazz;
+
+  /*! Name and JNI type signature of member */
+  const char* const name;
+  const char* const signature;
+
+  /*! Is this a static member? */
+  const bool is_static;
+
+  /*! Member ID - NULL if not looked up yet */
+  mutable std::atomic<TID> id;
+};
+
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
@@ -0,0 +1,252 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/jni/tJavaMethod.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-17
+ *
+ * \brief   Contains tJavaMethod and tJavaStaticMethod
+ *
+ * \b tJavaMethod
+ *
+ * Java method that can be called from C++.
+ * The JNI signature is generated from the C++ types at compile time
+ * and the method ID is looked up only once.
+ *
+ * Example:
+ *   static tJavaMethod<void(int, std::string)> callback("org/example/Listener", "onEvent");
+ *   callback(listener_object, 42, "event");
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__jni__tJavaMethod_h__
+#define __rrlib__jni__tJavaMethod_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/jni/tJavaMember.h"
+#include "rrlib/jni/type_traits.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace jni
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+namespace internal
+{
+
+/*! Releases converted arguments (e.g. local references to Java strings) */
+template <typename ... TArgs>
+struct tArgumentReleaser;
+
+template <>
+struct tArgumentReleaser<>
+{
+  static void Release(JNIEnv* env, const jvalue* values)
+  {}
+};
+
+template <typename T, typename ... TRest>
+struct tArgumentReleaser<T, TRest...>
+{
+  static void Release(JNIEnv* env, const jvalue* values)
+  {
+    tJNIType<T>::ReleaseJNI(env, *values);
+    tArgumentReleaser<TRest...>::Release(env, values + 1);
+  }
+};
+
+/*! C++ arguments converted to JNI values - released on destruction */
+template <typename ... TArgs>
+struct tArguments
+{
+  JNIEnv* const env;
+  const jvalue values[sizeof...(TArgs) + 1];
+
+  tArguments(JNIEnv* env, const TArgs& ... args) :
+    env(env),
+    values { tJNIType<TArgs>::ToJvalue(tJNIType<TArgs>::ToJNI(env, args))... }
+  {}
+
+  ~tArguments()
+  {
+    tArgumentReleaser<TArgs...>::Release(env, values);
+  }
+};
+
+/*! Calls method via JNI and converts result to C++ type R */
+template <typename R>
+struct tInvoker
+{
+  static R Call(JNIEnv* env, jobject object, jmethodID method, const jvalue* arguments)
+  {
+    return tJNIType<R>::FromJNI(env, tJNIType<R>::Call(env, object, method, arguments));
+  }
+  static R CallStatic(JNIEnv* env, jclass clazz, jmethodID method, const jvalue* arguments)
+  {
+    return tJNIType<R>::FromJNI(env, tJNIType<R>::CallStatic(env, clazz, method, arguments));
+  }
+};
+
+template <>
+struct tInvoker<void> : tJNIType<void>
+{};
+
+}
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+template <typename TFunction>
+class tJavaMethod;
+
+template <typename TFunction>
+class tJavaStaticMethod;
+
+//! Java method
+/*!
+ * Java (instance) method that can be called from C++ with C++ arguments (see tJNIType for supported types).
+ * Its JNI signature is generated at compile time - and its method ID is looked up once.
+ * If the method throws, the exception is pending after the call (check with ExceptionCheck()).
+ *
+ * \tparam R Return type
+ * \tparam TArgs Parameter types
+ */
+template <typename R, typename ... TArgs>
+class tJavaMethod<R(TArgs...)> : public internal::tJavaMember<jmethodID>
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! JNI type signature (generated from C++ types) */
+  typedef typename tMethodSignature<R, TArgs...>::type tSignature;
+
+  /*!
+   * \param class_name Fully-qualified name of Java class (e.g. "org/example/Listener")
+   * \param method_name Name of method
+   * \param signature JNI type signature - only needs to be specified if generated one is not appropriate
+   *                  (e.g. if method takes objects of a specific class). Must remain valid.
+   */
+  tJavaMethod(const char* class_name, const char* method_name, const char* signature = tSignature::value) :
+    tJavaMember(class_name, method_name, signature, false)
+  {}
+
+  /*!
+   * Calls method
+   *
+   * \param object Java object to call method on
+   * \param args Arguments
+   * \return Result of call
+   */
+  R Call(jobject object, const TArgs& ... args) const
+  {
+    JNIEnv* env = GetEnv();
+    internal::tArguments<TArgs...> arguments(env, args...);
+    return internal::tInvoker<R>::Call(env, object, GetID(env), arguments.values);
+  }
+
+  R operator()(jobject object, const TArgs& ... args) const
+  {
+    return Call(object, args...);
+  }
+};
+
+//! Static Java method
+/*!
+ * Static Java method that can be called from C++ with C++ arguments (see tJNIType for supported types).
+ * Its JNI signature is generated at compile time - and its method ID is looked up once.
+ * If the method throws, the exception is pending after the call (check with ExceptionCheck()).
+ *
+ * \tparam R Return type
+ * \tparam TArgs Parameter types
+ */
+template <typename R, typename ... TArgs>
+class tJavaStaticMethod<R(TArgs...)> : public internal::tJavaMember<jmethodID>
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! JNI type signature (generated from C++ types) */
+  typedef typename tMethodSignature<R, TArgs...>::type tSignature;
+
+  /*!
+   * \param class_name Fully-qualified name of Java class (e.g. "org/example/Listener")
+   * \param method_name Name of method
+   * \param signature JNI type signature - only needs to be specified if generated one is not appropriate
+   *                  (e.g. if method takes objects of a specific class). Must remain valid.
+   */
+  tJavaStaticMethod(const char* class_name, const char* method_name, const char* signature = tSignature::value) :
+    tJavaMember(class_name, method_name, signature, true)
+  {}
+
+  /*!
+   * Calls method
+   *
+   * \param args Arguments
+   * \return Result of call
+   */
+  R Call(const TArgs& ... args) const
+  {
+    JNIEnv* env = GetEnv();
+    jmethodID method = GetID(env);
+    internal::tArguments<TArgs...> arguments(env, args...);
+    return internal::tInvoker<R>::CallStatic(env, GetClass().Get(env), method, arguments.values);
+  }
+
+  R operator()(const TArgs& ... args) const
+  {
+    return Call(args...);
+  }
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
@@ -0,0 +1,259 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/jni/tJavaObjectHandle.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-17
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/jni/tJavaObjectHandle.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/thread/tLock.h"
+#include <atomic>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/jni/class_loader.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace jni
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+namespace
+{
+
+/*! Process-wide handle table */
+struct tHandleTable
+{
+  /*! Mutex for slot allocation and release */
+  rrlib::thread::tMutex mutex;
+
+  /*! Global references to Java Object[] slabs (slabs are never removed, so they may be read without lock) */
+  std::atomic<jobjectArray> slabs[tJavaObjectHandle::cMAX_SLABS];
+
+  /*! Number of allocated slabs */
+  uint32_t slab_count;
+
+  /*! Index of first slot that has never been used */
+  uint32_t next_unused_slot;
+
+  /*! Released slots for reuse */
+  std::vector<uint32_t> free_slots;
+
+  tHandleTable() :
+    mutex(),
+    slab_count(0),
+    next_unused_slot(0),
+    free_slots()
+  {
+    for (auto & slab : slabs)
+    {
+      slab.store(NULL, std::memory_order_relaxed);
+    }
+  }
+};
+
+/*! Handle table is intentionally never deleted (handles may be released during static destruction) */
+tHandleTable& GetHandleTable()
+{
+  static tHandleTable* table = new tHandleTable();
+  return *table;
+}
+
+/*! \return Global reference to new (empty) slab - NULL if allocation failed (then, a Java exception is pending) */
+jobjectArray NewSlab(JNIEnv* env)
+{
+  jclass object_class = FindClass("java/lang/Object", env);
+  jobjectArray local_slab = object_class ? env->NewObjectArray(tJavaObjectHandle::cSLAB_SIZE, object_class, NULL) : NULL;
+  if (local_slab == NULL)
+  {
+    return NULL;
+  }
+  jobjectArray slab = static_cast<jobjectArray>(env->NewGlobalRef(local_slab));
+  env->DeleteLocalRef(local_slab);
+  return slab;
+}
+
+/*!
+ * Obtains free slot in handle table - allocating new slab if required.
+ * Slabs are allocated without holding the table's mutex (allocation may take long, e.g. if it triggers garbage collection).
+ *
+ * \return Slot index - or -1 if no slot could be obtained (then, a Java exception is pending)
+ */
+int64_t AcquireSlot(JNIEnv* env)
+{
+  tHandleTable& table = GetHandleTable();
+  while (true)
+  {
+    uint32_t slab_index = 0;
+    {
+      rrlib::thread::tLock lock(table.mutex);
+      if (!table.free_slots.empty())
+      {
+        uint32_t slot = table.free_slots.back();
+        table.free_slots.pop_back();
+        return slot;
+      }
+      if (table.next_unused_slot < table.slab_count * tJavaObjectHandle::cSLAB_SIZE)
+      {
+        return table.next_unused_slot++;
+      }
+      slab_index = table.slab_count;
+    }
+
+    if (slab_index == tJavaObjectHandle::cMAX_SLABS)
+    {
+      jclass error_class = env->FindClass("java/lang/OutOfMemoryError");
+      if (error_class != NULL)
+      {
+        env->ThrowNew(error_class, "rrlib_jni handle table is full");
+        env->DeleteLocalRef(error_class);
+      }
+      return -1;
+    }
+    jobjectArray slab = NewSlab(env);
+    if (slab == NULL)
+    {
+      return -1;
+    }
+    {
+      rrlib::thread::tLock lock(table.mutex);
+      if (table.slab_count == slab_index)
+      {
+        table.slabs[slab_index].store(slab, std::memory_order_release);
+        table.slab_count++;
+        slab = NULL;
+      }
+    }
+    if (slab != NULL)
+    {
+      env->DeleteGlobalRef(slab); // other thread was faster
+    }
+  }
+}
+
+/*! \return Global reference to slab containing specified slot */
+inline jobjectArray GetSlab(uint32_t slot)
+{
+  jobjectArray slab = GetHandleTable().slabs[slot / tJavaObjectHandle::cSLAB_SIZE].load(std::memory_order_acquire);
+  assert(slab != NULL);
+  return slab;
+}
+
+}
+
+jobject tJavaObjectHandle::Get(JNIEnv* env) const
+{
+  if (handle == 0)
+  {
+    return NULL;
+  }
+  uint32_t slot = handle - 1;
+  return env->GetObjectArrayElement(GetSlab(slot), slot % cSLAB_SIZE);
+}
+
+size_t tJavaObjectHandle::GetHandleCount()
+{
+  tHandleTable& table = GetHandleTable();
+  rrlib::thread::tLock lock(table.mutex);
+  return table.next_unused_slot - table.free_slots.size();
+}
+
+size_t tJavaObjectHandle::GetSlabCount()
+{
+  tHandleTable& table = GetHandleTable();
+  rrlib::thread::tLock lock(table.mutex);
+  return table.slab_count;
+}
+
+void tJavaObjectHandle::Reset(JNIEnv* env)
+{
+  if (handle == 0)
+  {
+    return;
+  }
+  uint32_t slot = handle - 1;
+  handle = 0;
+  if (env == NULL)
+  {
+    env = GetEnv();
+  }
+  env->SetObjectArrayElement(GetSlab(slot), slot % cSLAB_SIZE, NULL);
+
+  tHandleTable& table = GetHandleTable();
+  rrlib::thread::tLock lock(table.mutex);
+  table.free_slots.push_back(slot);
+}
+
+void tJavaObjectHandle::Set(jobject java_object, JNIEnv* env)
+{
+  Reset(env);
+  if (java_object == NULL)
+  {
+    return;
+  }
+  int64_t slot = AcquireSlot(env);
+  if (slot >= 0)
+  {
+    env->SetObjectArrayElement(GetSlab(slot), slot % cSLAB_SIZE, java_object);
+    handle = static_cast<uint32_t>(slot) + 1;
+  }
+  env->DeleteLocalRef(java_object);
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
@@ -0,0 +1,167 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/jni/tJavaObjectHandle.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-17
+ *
+ * \brief   Contains tJavaObjectHandle
+ *
+ * \b tJavaObjectHandle
+ *
+ * Alternative to tJavaObjectReference that does not create a JNI global
+ * reference per object. Objects are stored in a handle table made up of
+ * large Java Object[] slabs - each held by a single global reference.
+ * A handle only stores a 32 bit slot index. Freed slots are reused.
+ *
+ * With many (e.g. millions) referenced objects, this keeps the JVM's
+ * global reference table small - which is scanned in every GC pause.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__jni__tJavaObjectHandle_h__
+#define __rrlib__jni__tJavaObjectHandle_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/util/tNoncopyable.h"
+#include <cstddef>
+#include <stdint.h>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/jni/jvm.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace jni
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Handle to Java object in handle table
+/*!
+ * Keeps the specified Java object alive (like a global reference) by storing it in a slot of the
+ * process-wide handle table. The slot is released upon destruction or reassignment.
+ *
+ * In contrast to tJavaObjectReference, only strong references are supported and Get() returns
+ * a new local reference (the table's contents may only be accessed via JNI calls).
+ *
+ * Thread-safe with respect to other handles. A single handle must not be modified concurrently.
+ */
+class tJavaObjectHandle : private rrlib::util::tNoncopyable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! Number of objects in each Java Object[] slab of handle table */
+  static const uint32_t cSLAB_SIZE = 4096;
+
+  /*! Maximum number of slabs in handle table */
+  static const uint32_t cMAX_SLABS = 4096;
+
+  tJavaObjectHandle() :
+    handle(0)
+  {}
+
+  /*! \param java_object Java object to hold initially */
+  explicit tJavaObjectHandle(jobject java_object, JNIEnv* env = GetEnv()) :
+    handle(0)
+  {
+    Set(java_object, env);
+  }
+
+  ~tJavaObjectHandle()
+  {
+    Reset();
+  }
+
+  /*!
+   * \param env JNIEnv of current thread
+   * \return New local reference to Java object (NULL if this handle holds no object)
+   */
+  jobject Get(JNIEnv* env = GetEnv()) const;
+
+  /*! \return Raw handle value (0 if this handle holds no object; slot index + 1 otherwise) */
+  uint32_t GetHandle() const
+  {
+    return handle;
+  }
+
+  /*! \return Number of objects currently stored in handle table (all handles) */
+  static size_t GetHandleCount();
+
+  /*! \return Number of slabs currently allocated in handle table */
+  static size_t GetSlabCount();
+
+  /*! \return Whether this handle holds no object */
+  bool IsNull() const
+  {
+    return handle == 0;
+  }
+
+  /*! Releases slot of any held object */
+  void Reset(JNIEnv* env = NULL);
+
+  /*!
+   * Stores specified java object in handle table. Releases slot of any old object.
+   * As with tJavaObjectReference::Set, the local reference to the specified object is deleted.
+   *
+   * If the handle table is exhausted or a new slab cannot be allocated,
+   * this handle remains empty and a Java exception is pending.
+   *
+   * \param java_object Java object to hold (local reference)
+   * \param env JNIEnv of current thread
+   */
+  void Set(jobject java_object, JNIEnv* env = GetEnv());
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Slot index + 1 (0 if this handle holds no object) */
+  uint32_t handle;
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
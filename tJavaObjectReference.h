@@ -32,6 +32,17 @@
  * Maintains a global reference to the specified java object.
  * It releases reference upon destruction or reassignment.
  *
+ * If RRLIB_JNI_COMPACT_OBJECT_REFERENCE is defined, a reference only
+ * occupies a single word: whether C++ is responsible (strong vs. weak
+ * global reference) is not stored but queried from the JVM
+ * (GetObjectRefType) when the reference is released.
+ * As this changes the layout of tJavaObjectReference (and tJNIWrappable),
+ * it must be defined for the library and all code using it - or for none.
+ * Mixing both settings results in a link error (undefined reference to
+ * object_reference_layout_compact or object_reference_layout_full).
+ *
+ * Releasing references can be deferred to a background thread (see deferred_release.h).
+ *
  */
 //----------------------------------------------------------------------
 #ifndef __rrlib__jni__tJavaObjectReference_h__
@@ -45,6 +56,8 @@
 // Internal includes with ""
 //----------------------------------------------------------------------
 #include "rrlib/jni/jvm.h"
+#include "rrlib/jni/deferred_release.h"
+#include "rrlib/jni/instrumentation.h"
 
 //----------------------------------------------------------------------
 // Namespace declaration
@@ -58,6 +71,23 @@ namespace jni
 // Forward declarations / typedefs / enums
 //----------------------------------------------------------------------
 
+namespace internal
+{
+
+/*!
+ * Link-time guard against mixing RRLIB_JNI_COMPACT_OBJECT_REFERENCE settings:
+ * The library only defines the symbol matching its own setting (see tJavaObjectReference.cpp).
+ */
+#ifdef RRLIB_JNI_COMPACT_OBJECT_REFERENCE
+extern const int object_reference_layout_compact;
+__attribute__((used)) static const int* const object_reference_layout = &object_reference_layout_compact;
+#else
+extern const int object_reference_layout_full;
+__attribute__((used)) static const int* const object_reference_layout = &object_reference_layout_full;
+#endif
+
+}
+
 //----------------------------------------------------------------------
 // Class declaration
 //----------------------------------------------------------------------
@@ -75,14 +105,18 @@ class tJavaObjectReference
 public:
 
   tJavaObjectReference() :
-    java_object(NULL),
-    cpp_responsible(false)
+    java_object(NULL)
+#ifndef RRLIB_JNI_COMPACT_OBJECT_REFERENCE
+    , cpp_responsible(false)
+#endif
   {}
 
   /*! \param java_object_ Java object to hold initially */
   tJavaObjectReference(jobject java_object_, bool cpp_responsible_) :
-    java_object(NULL),
-    cpp_responsible(false)
+    java_object(NULL)
+#ifndef RRLIB_JNI_COMPACT_OBJECT_REFERENCE
+    , cpp_responsible(false)
+#endif
   {
     Set(java_object_, cpp_responsible_);
   }
@@ -101,14 +135,18 @@ public:
   void Set(jobject java_object_, bool cpp_responsible_)
   {
     Reset();
+#ifndef RRLIB_JNI_COMPACT_OBJECT_REFERENCE
     cpp_responsible = cpp_responsible_;
+#endif
     if (cpp_responsible_)
     {
       java_object = GetEnv()->NewGlobalRef(java_object_);
+      RRLIB_JNI_COUNT(GLOBAL_REF_CREATED);
     }
     else
     {
       java_object = GetEnv()->NewWeakGlobalRef(java_object_);
+      RRLIB_JNI_COUNT(WEAK_GLOBAL_REF_CREATED);
     }
     GetEnv()->DeleteLocalRef(java_object_);
   }
@@ -129,31 +167,54 @@ private:
   /*! Java Object currently "locked" */
   jobject java_object;
 
+#ifndef RRLIB_JNI_COMPACT_OBJECT_REFERENCE
   /*! Is C++ responsible for cleaning up this object and "holding" Java object? */
   bool cpp_responsible;
+#endif
 
 
   tJavaObjectReference(const tJavaObjectReference&) = delete;
   tJavaObjectReference& operator=(const tJavaObjectReference&) = delete;
 
-  /*!  Releases global reference to any old object. */
+  /*! \return Is C++ responsible for cleaning up this object and "holding" Java object? (java_object must not be NULL) */
+  bool IsCppResponsible()
+  {
+#ifdef RRLIB_JNI_COMPACT_OBJECT_REFERENCE
+    return GetEnv()->GetObjectRefType(java_object) == JNIGlobalRefType;
+#else
+    return cpp_responsible;
+#endif
+  }
+
+  /*!
+   * Releases global reference to any old object.
+   * If deferred release is enabled (see deferred_release.h), this does not call into the Java VM.
+   */
   void Reset()
   {
-    if (java_object != NULL)
+    if (java_object != NULL && (!internal::ReleaseDeferred(java_object)))
     {
-      if (cpp_responsible)
+      if (IsCppResponsible())
       {
         GetEnv()->DeleteGlobalRef(java_object);
+        RRLIB_JNI_COUNT(GLOBAL_REF_DELETED);
       }
       else
       {
         GetEnv()->DeleteWeakGlobalRef(java_object);
+        RRLIB_JNI_COUNT(WEAK_GLOBAL_REF_DELETED);
       }
-      java_object = NULL;
     }
+    java_object = NULL;
   }
 };
 
+#ifdef RRLIB_JNI_COMPACT_OBJECT_REFERENCE
+static_assert(sizeof(tJavaObjectReference) == sizeof(jobject), "Compact tJavaObjectReference must occupy a single word");
+#else
+static_assert(sizeof(tJavaObjectReference) == 2 * sizeof(jobject), "tJavaObjectReference must occupy two words");
+#endif
+
 //----------------------------------------------------------------------
 // End of namespace declaration
 //----------------------------------------------------------------------
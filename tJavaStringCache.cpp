@@ -0,0 +1,160 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/jni/tJavaStringCache.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-17
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/jni/tJavaStringCache.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/thread/tLock.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace jni
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+tJavaStringCache::tJavaStringCache(size_t max_size) :
+  max_size(max_size),
+  mutex(),
+  entries(),
+  lru_list(),
+  hit_count(0),
+  miss_count(0)
+{
+  assert(max_size > 0);
+}
+
+tJavaStringCache::~tJavaStringCache()
+{
+  if (GetJavaVM() != NULL)
+  {
+    Clear();
+  }
+}
+
+void tJavaStringCache::Clear()
+{
+  rrlib::thread::tLock l(mutex);
+  JNIEnv* env = GetEnv();
+  for (auto it = entries.begin(); it != entries.end(); ++it)
+  {
+    env->DeleteGlobalRef(it->second.java_string);
+  }
+  entries.clear();
+  lru_list.clear();
+}
+
+jstring tJavaStringCache::Get(const char* s, size_t length)
+{
+  JNIEnv* env = GetEnv();
+  rrlib::thread::tLock l(mutex);
+  tKey key = { s, length };
+  auto it = entries.find(key);
+  if (it != entries.end())
+  {
+    hit_count.fetch_add(1, std::memory_order_relaxed);
+    lru_list.splice(lru_list.begin(), lru_list, it->second.lru_position);
+    return static_cast<jstring>(env->NewLocalRef(it->second.java_string));
+  }
+
+  miss_count.fetch_add(1, std::memory_order_relaxed);
+  if (memchr(s, '\0', length))
+  {
+    env->ThrowNew(env->FindClass("java/lang/IllegalArgumentException"), "String contains null byte");
+    return NULL;
+  }
+  std::string content(s, length); // null-terminated copy - later owned by lru_list
+  jstring local_string = env->NewStringUTF(content.c_str());
+  if (local_string == NULL)
+  {
+    return NULL; // OutOfMemoryError is pending
+  }
+  jstring global_string = static_cast<jstring>(env->NewGlobalRef(local_string));
+  if (global_string == NULL)
+  {
+    env->DeleteLocalRef(local_string);
+    return NULL; // OutOfMemoryError is pending
+  }
+  if (entries.size() >= max_size)
+  {
+    const std::string& evicted_content = lru_list.back();
+    tKey evicted_key = { evicted_content.data(), evicted_content.length() };
+    auto evicted = entries.find(evicted_key);
+    env->DeleteGlobalRef(evicted->second.java_string);
+    entries.erase(evicted);
+    lru_list.pop_back();
+  }
+  lru_list.push_front(std::move(content));
+  tEntry entry;
+  entry.java_string = global_string;
+  entry.lru_position = lru_list.begin();
+  tKey stored_key = { lru_list.front().data(), lru_list.front().length() };
+  entries.insert(std::make_pair(stored_key, entry));
+  return local_string;
+}
+
+tJavaStringCache& tJavaStringCache::GetDefaultInstance()
+{
+  static tJavaStringCache* instance = new tJavaStringCache(); // never deleted: Java VM might already be gone at static destruction
+  return *instance;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
@@ -0,0 +1,204 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/jni/tJavaStringCache.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-17
+ *
+ * \brief   Contains tJavaStringCache
+ *
+ * \b tJavaStringCache
+ *
+ * Cache with Java strings for frequently converted C++ strings
+ * (e.g. port names, units or enum constants).
+ * Size is bounded - least recently used strings are evicted.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__jni__tJavaStringCache_h__
+#define __rrlib__jni__tJavaStringCache_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/thread/tMutex.h"
+#include <atomic>
+#include <cstring>
+#include <list>
+#include <string>
+#include <unordered_map>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/jni/jvm.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace jni
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Cache for Java strings
+/*!
+ * Maps C++ string content to global references of Java strings with the same content.
+ * Instead of allocating a new Java string on every conversion, the cached instance is returned.
+ * Thread-safe.
+ */
+class tJavaStringCache : private rrlib::util::tNoncopyable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! \param max_size Maximum number of cached strings */
+  explicit tJavaStringCache(size_t max_size = 1024);
+
+  ~tJavaStringCache();
+
+  /*! Removes all strings from cache */
+  void Clear();
+
+  /*!
+   * \param s C++ string (modified UTF-8 - must not contain null bytes)
+   * \param length Length of string in bytes
+   * \return Local reference to cached Java string with same content (Java string is created and cached on first request).
+   *         NULL with pending Java exception if string contains null bytes (IllegalArgumentException) or allocation fails.
+   */
+  jstring Get(const char* s, size_t length);
+
+  /*!
+   * \param s Null-terminated C++ string (modified UTF-8)
+   * \return Local reference to cached Java string with same content (Java string is created and cached on first request)
+   */
+  jstring Get(const char* s)
+  {
+    return Get(s, strlen(s));
+  }
+
+  /*!
+   * \param s C++ string (modified UTF-8 - must not contain null bytes)
+   * \return Local reference to cached Java string with same content (Java string is created and cached on first request)
+   */
+  jstring Get(const std::string& s)
+  {
+    return Get(s.data(), s.length());
+  }
+
+  /*! \return Default cache instance used by ToCachedJstring() */
+  static tJavaStringCache& GetDefaultInstance();
+
+  /*! \return Number of requests for which string was found in cache */
+  uint64_t GetHitCount() const
+  {
+    return hit_count.load(std::memory_order_relaxed);
+  }
+
+  /*! \return Maximum number of cached strings */
+  size_t GetMaxSize() const
+  {
+    return max_size;
+  }
+
+  /*! \return Number of requests for which Java string had to be created */
+  uint64_t GetMissCount() const
+  {
+    return miss_count.load(std::memory_order_relaxed);
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Key in map with cached strings - refers to string content (owned by lru_list, or by caller during lookup) */
+  struct tKey
+  {
+    const char* data;
+    size_t length;
+
+    bool operator==(const tKey& other) const
+    {
+      return length == other.length && memcmp(data, other.data, length) == 0;
+    }
+  };
+
+  /*! Hash function for keys (FNV-1a) */
+  struct tKeyHash
+  {
+    size_t operator()(const tKey& key) const
+    {
+      uint64_t hash = 14695981039346656037ULL;
+      for (size_t i = 0; i < key.length; i++)
+      {
+        hash = (hash ^ static_cast<unsigned char>(key.data[i])) * 1099511628211ULL;
+      }
+      return static_cast<size_t>(hash);
+    }
+  };
+
+  /*! Cache entry */
+  struct tEntry
+  {
+    /*! Global reference to Java string */
+    jstring java_string;
+
+    /*! Position in list of recently used strings */
+    std::list<std::string>::iterator lru_position;
+  };
+
+  /*! Maximum number of cached strings */
+  const size_t max_size;
+
+  /*! Mutex for cache access */
+  rrlib::thread::tMutex mutex;
+
+  /*! Cached strings (lookup does not require allocating a std::string) */
+  std::unordered_map<tKey, tEntry, tKeyHash> entries;
+
+  /*! Contents of cached strings - most recently used first (list nodes do not move, so keys may point into them) */
+  std::list<std::string> lru_list;
+
+  /*! Hit and miss counters */
+  std::atomic<uint64_t> hit_count, miss_count;
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
@@ -0,0 +1,178 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/jni/tLocalFrame.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-17
+ *
+ * \brief   Contains tLocalFrame
+ *
+ * \b tLocalFrame
+ *
+ * Scoped frame for JNI local references.
+ * All local references created while the frame exists are released
+ * when it goes out of scope (or is popped).
+ * Typically used in loops that call e.g. ToJstring() or GetJavaWrapper() many times.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__jni__tLocalFrame_h__
+#define __rrlib__jni__tLocalFrame_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/util/tNoncopyable.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/jni/jvm.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace jni
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Scoped frame for local references
+/*!
+ * Pushes a local reference frame on construction and pops it on destruction.
+ * A single reference can be passed out of the frame using Pop().
+ */
+class tLocalFrame : private rrlib::util::tNoncopyable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*!
+   * \param capacity Number of local references that can at least be created in this frame
+   * \param env JNIEnv of current thread
+   */
+  explicit tLocalFrame(jint capacity = 16, JNIEnv* env = GetEnv()) :
+    env(env),
+    pushed(env->PushLocalFrame(capacity) == 0),
+    popped(false)
+  {
+    assert(pushed && "Could not push local frame (OutOfMemoryError)");
+  }
+
+  ~tLocalFrame()
+  {
+    if (pushed && (!popped))
+    {
+      env->PopLocalFrame(NULL);
+    }
+  }
+
+  /*!
+   * Pops frame - releasing all local references created in it.
+   * A new local reference to 'result' is created in the enclosing frame.
+   *
+   * \param result Local reference (created in this frame) to pass to the enclosing frame (may be NULL)
+   * \return Local reference to result valid in enclosing frame
+   *         (if frame could not be pushed, 'result' itself is returned - as it was created in the enclosing frame)
+   */
+  template <typename T>
+  T Pop(T result)
+  {
+    assert(!popped && "Frame has already been popped");
+    popped = true;
+    return pushed ? static_cast<T>(env->PopLocalFrame(result)) : result;
+  }
+
+  /*! Pops frame - releasing all local references created in it */
+  void Pop()
+  {
+    Pop<jobject>(NULL);
+  }
+
+  /*! \return Whether frame was actually pushed (false if PushLocalFrame failed - then, an OutOfMemoryError is pending) */
+  bool IsPushed() const
+  {
+    return pushed;
+  }
+
+  /*! \return JNIEnv this frame was created with */
+  JNIEnv* GetJNIEnv() const
+  {
+    return env;
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! JNIEnv of thread that created frame */
+  JNIEnv* const env;
+
+  /*! Was frame pushed successfully? (otherwise, it must not be popped) */
+  const bool pushed;
+
+  /*! Has frame already been popped? */
+  bool popped;
+};
+
+//----------------------------------------------------------------------
+// Function declarations
+//----------------------------------------------------------------------
+
+/*!
+ * Ensures that at least the specified number of local references can be created in the current frame.
+ * Calling this once before creating e.g. 'element_count' strings in a loop avoids growing the local reference table step by step.
+ *
+ * \param element_count Number of local references that will be created
+ * \param env JNIEnv of current thread
+ * \return True on success. Otherwise an OutOfMemoryError is pending.
+ */
+inline bool EnsureLocalCapacity(jint element_count, JNIEnv* env = GetEnv())
+{
+  return env->EnsureLocalCapacity(element_count) == 0;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
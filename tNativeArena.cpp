@@ -0,0 +1,198 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/jni/tNativeArena.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-17
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/jni/tNativeArena.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cstdlib>
+#include <unistd.h>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/jni/direct_buffers.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace jni
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+const size_t tNativeArena::cCACHE_LINE_ALIGNMENT;
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+tNativeArena::tNativeArena(size_t block_size) :
+  block_size(block_size),
+  blocks(),
+  large_blocks(),
+  current_block(0),
+  current_offset(0)
+{
+  assert(block_size > 0);
+}
+
+tNativeArena::~tNativeArena()
+{
+  Reset();
+  for (tBlock & block : blocks)
+  {
+    UnregisterMemoryRegion(block.memory);
+    free(block.memory);
+  }
+}
+
+void* tNativeArena::Allocate(size_t size, size_t alignment)
+{
+  assert(alignment > 0 && (alignment & (alignment - 1)) == 0 && "Alignment must be a power of two");
+  assert(alignment <= GetPageSize() && "Alignment must not exceed page size");
+
+  // Large allocations get a dedicated block
+  if (size > block_size / 2)
+  {
+    tBlock block = AllocateBlock(size);
+    if (block.memory != NULL)
+    {
+      large_blocks.push_back(block);
+    }
+    return block.memory;
+  }
+
+  // Find block with enough space (blocks are page-aligned, so aligning offsets suffices)
+  while (true)
+  {
+    if (current_block == blocks.size())
+    {
+      tBlock block = AllocateBlock(block_size);
+      if (block.memory == NULL)
+      {
+        return NULL;
+      }
+      blocks.push_back(block);
+      RegisterMemoryRegion(block.memory, block.size); // so that buffers for block are cached
+    }
+    size_t offset = (current_offset + alignment - 1) & ~(alignment - 1);
+    if (offset + size <= blocks[current_block].size)
+    {
+      current_offset = offset + size;
+      return blocks[current_block].memory + offset;
+    }
+    current_block++;
+    current_offset = 0;
+  }
+}
+
+tNativeArena::tBlock tNativeArena::AllocateBlock(size_t size)
+{
+  tBlock block = { NULL, size };
+  void* memory = NULL;
+  if (posix_memalign(&memory, GetPageSize(), size) == 0)
+  {
+    block.memory = static_cast<char*>(memory);
+  }
+  return block;
+}
+
+bool tNativeArena::GetBlock(const void* address, void*& block_memory, size_t& block_size, bool& cached) const
+{
+  const char* pointer = static_cast<const char*>(address);
+  for (const std::vector<tBlock>* block_list : { &blocks, &large_blocks })
+  {
+    for (const tBlock & block : *block_list)
+    {
+      if (pointer >= block.memory && pointer < block.memory + block.size)
+      {
+        block_memory = block.memory;
+        block_size = block.size;
+        cached = (block_list == &blocks);
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+size_t tNativeArena::GetPageSize()
+{
+  static const size_t cPAGE_SIZE = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  return cPAGE_SIZE;
+}
+
+size_t tNativeArena::GetReservedBytes() const
+{
+  size_t result = 0;
+  for (const tBlock & block : blocks)
+  {
+    result += block.size;
+  }
+  for (const tBlock & block : large_blocks)
+  {
+    result += block.size;
+  }
+  return result;
+}
+
+void tNativeArena::Reset()
+{
+  for (tBlock & block : large_blocks)
+  {
+    free(block.memory);
+  }
+  large_blocks.clear();
+  current_block = 0;
+  current_offset = 0;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
@@ -0,0 +1,176 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/jni/tNativeArena.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-17
+ *
+ * \brief   Contains tNativeArena
+ *
+ * \b tNativeArena
+ *
+ * Arena allocator for native memory that is used by Java code (via direct byte buffers).
+ * Allocations are served from large blocks by bumping a pointer.
+ * Memory is not released individually - but for all allocations at once.
+ *
+ * Java code does not get a new direct byte buffer per allocation:
+ * JNICalls.arenaAllocate returns the address of the allocated memory, and
+ * JNICalls.arenaGetBlockBuffer the buffer of the block containing an address.
+ * Buffers of regular blocks are cached (see direct_buffers.h) - so Java code only needs to
+ * request a block's buffer once and can then slice allocations from it (offset = address - block address).
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__jni__tNativeArena_h__
+#define __rrlib__jni__tNativeArena_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/util/tNoncopyable.h"
+#include <cstddef>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace jni
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Arena allocator for native memory
+/*!
+ * Allocates aligned memory from large blocks by bumping a pointer.
+ * Reset() releases all allocations at once - keeping the blocks for reuse.
+ * Blocks are returned to the system when the arena is deleted.
+ *
+ * Not thread-safe: each arena should only be used by one thread at a time.
+ */
+class tNativeArena : private rrlib::util::tNoncopyable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! Alignment for cache lines (e.g. for SIMD code) */
+  static const size_t cCACHE_LINE_ALIGNMENT = 64;
+
+  /*!
+   * \param block_size Size of memory blocks that are allocated from system
+   *                   (larger allocations are served from dedicated blocks)
+   */
+  explicit tNativeArena(size_t block_size = 1024 * 1024);
+
+  ~tNativeArena();
+
+  /*!
+   * Allocates memory from arena
+   *
+   * \param size Size of memory to allocate in bytes
+   * \param alignment Alignment of memory in bytes (must be a power of two - at most page size)
+   * \return Pointer to allocated memory - NULL if system memory is exhausted
+   */
+  void* Allocate(size_t size, size_t alignment = cCACHE_LINE_ALIGNMENT);
+
+  /*!
+   * Looks up block containing specified address
+   *
+   * \param address Address of memory allocated from this arena
+   * \param block_memory Is set to start address of block
+   * \param block_size Is set to size of block
+   * \param cached Is set to whether block is a regular block - registered as memory region (see direct_buffers.h) until arena is deleted
+   * \return Whether a block containing address was found
+   */
+  bool GetBlock(const void* address, void*& block_memory, size_t& block_size, bool& cached) const;
+
+  /*! \return Size of memory blocks allocated from system */
+  size_t GetBlockSize() const
+  {
+    return block_size;
+  }
+
+  /*! \return Page size of system (maximum alignment - e.g. for DMA) */
+  static size_t GetPageSize();
+
+  /*! \return Number of bytes currently allocated from system */
+  size_t GetReservedBytes() const;
+
+  /*!
+   * Releases all allocations (memory may be handed out again by subsequent allocations).
+   * Any buffers referring to allocated memory must not be used anymore.
+   */
+  void Reset();
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Memory block allocated from system */
+  struct tBlock
+  {
+    char* memory;
+    size_t size;
+  };
+
+  /*! Size of memory blocks that are allocated from system */
+  const size_t block_size;
+
+  /*! Regular blocks (of size block_size) */
+  std::vector<tBlock> blocks;
+
+  /*! Dedicated blocks for large allocations (freed on Reset()) */
+  std::vector<tBlock> large_blocks;
+
+  /*! Index of block that allocations are currently served from */
+  size_t current_block;
+
+  /*! Offset of first unused byte in current block */
+  size_t current_offset;
+
+  /*! Allocates block with specified size from system - memory is NULL on failure */
+  static tBlock AllocateBlock(size_t size);
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
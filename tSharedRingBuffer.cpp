@@ -0,0 +1,230 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/jni/tSharedRingBuffer.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-17
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/jni/tSharedRingBuffer.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <thread>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/jni/tJavaMethod.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace jni
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+const size_t tSharedRingBuffer::cWRITE_INDEX_OFFSET;
+const size_t tSharedRingBuffer::cREAD_INDEX_OFFSET;
+const size_t tSharedRingBuffer::cRESERVE_INDEX_OFFSET;
+const size_t tSharedRingBuffer::cDATA_OFFSET;
+const size_t tSharedRingBuffer::cHEADER_SIZE;
+const uint32_t tSharedRingBuffer::cPADDING_FLAG;
+
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "Indices shared with Java must be lock-free");
+static_assert(sizeof(std::atomic<uint64_t>) == sizeof(uint64_t), "Indices shared with Java must be plain 64 bit values");
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+namespace
+{
+
+/*! Allocates shared memory for ring buffer with specified capacity */
+char* AllocateSharedMemory(size_t capacity)
+{
+  assert(capacity >= 64 && (capacity & (capacity - 1)) == 0 && "Capacity must be a power of two");
+  void* memory = NULL;
+  __attribute__((unused)) // prevents warning in release mode
+  int res = posix_memalign(&memory, 64, tSharedRingBuffer::cDATA_OFFSET + capacity);
+  assert(res == 0 && "Allocating ring buffer failed");
+  memset(memory, 0, tSharedRingBuffer::cDATA_OFFSET);
+  reinterpret_cast<uint64_t*>(memory)[0] = capacity;
+  return static_cast<char*>(memory);
+}
+
+/*! Java methods for setting byte order of buffers returned by GetJavaBuffer() */
+const tJavaStaticMethod<jobject()> native_byte_order("java/nio/ByteOrder", "nativeOrder", "()Ljava/nio/ByteOrder;");
+const tJavaMethod<jobject(jobject)> set_byte_order("java/nio/ByteBuffer", "order", "(Ljava/nio/ByteOrder;)Ljava/nio/ByteBuffer;");
+
+/*! \return Number of bytes a record with specified payload size occupies */
+inline uint64_t RecordSize(size_t payload_size)
+{
+  return tSharedRingBuffer::cHEADER_SIZE + ((payload_size + 7) & ~static_cast<size_t>(7));
+}
+
+}
+
+tSharedRingBuffer::tSharedRingBuffer(size_t capacity, bool multi_producer) :
+  capacity(capacity),
+  multi_producer(multi_producer),
+  memory(AllocateSharedMemory(capacity)),
+  write_index(*new(memory + cWRITE_INDEX_OFFSET) std::atomic<uint64_t>(0)),
+  read_index(*new(memory + cREAD_INDEX_OFFSET) std::atomic<uint64_t>(0)),
+  reserve_index(*new(memory + cRESERVE_INDEX_OFFSET) std::atomic<uint64_t>(0)),
+  data(memory + cDATA_OFFSET)
+{}
+
+tSharedRingBuffer::~tSharedRingBuffer()
+{
+  free(memory);
+}
+
+jobject tSharedRingBuffer::GetJavaBuffer(JNIEnv* env) const
+{
+  jobject buffer = env->NewDirectByteBuffer(memory, cDATA_OFFSET + capacity);
+  if (buffer == NULL)
+  {
+    return NULL;
+  }
+  jobject byte_order = native_byte_order();
+  if (byte_order == NULL)
+  {
+    env->DeleteLocalRef(buffer);
+    return NULL;
+  }
+  jobject result = set_byte_order(buffer, byte_order); // returns the same buffer
+  env->DeleteLocalRef(byte_order);
+  env->DeleteLocalRef(buffer);
+  return result;
+}
+
+bool tSharedRingBuffer::Read(void* buffer, size_t buffer_size, size_t& record_size)
+{
+  uint64_t read = read_index.load(std::memory_order_relaxed);
+  uint64_t write = write_index.load(std::memory_order_acquire);
+  while (read != write)
+  {
+    // Headers may be written by Java code - so they are validated before any memory is accessed based on them
+    const uint64_t available = write - read;
+    const uint64_t contiguous = capacity - (read & (capacity - 1));
+    const uint32_t* header = reinterpret_cast<const uint32_t*>(data + (read & (capacity - 1)));
+    if (header[1] & cPADDING_FLAG)
+    {
+      if (contiguous > available)
+      {
+        break; // invalid padding record
+      }
+      read += contiguous;
+      read_index.store(read, std::memory_order_release);
+      continue;
+    }
+    record_size = header[0];
+    if (record_size > GetMaxRecordSize() || RecordSize(record_size) > available || RecordSize(record_size) > contiguous)
+    {
+      break; // invalid record
+    }
+    if (record_size > buffer_size)
+    {
+      return false;
+    }
+    memcpy(buffer, header + 2, record_size);
+    read_index.store(read + RecordSize(record_size), std::memory_order_release);
+    return true;
+  }
+  record_size = 0;
+  return false;
+}
+
+bool tSharedRingBuffer::Write(const void* payload, size_t size)
+{
+  assert(size <= GetMaxRecordSize() && "Record too large");
+  const uint64_t record_size = RecordSize(size);
+
+  // Reserve space (start index and number of bytes including any padding)
+  uint64_t start = multi_producer ? reserve_index.load(std::memory_order_relaxed) : write_index.load(std::memory_order_relaxed);
+  uint64_t total_size = 0;
+  while (true)
+  {
+    uint64_t contiguous = capacity - (start & (capacity - 1));
+    total_size = record_size + (contiguous < record_size ? contiguous : 0);
+    if (start + total_size - read_index.load(std::memory_order_acquire) > capacity)
+    {
+      return false;
+    }
+    if ((!multi_producer) || reserve_index.compare_exchange_weak(start, start + total_size, std::memory_order_relaxed))
+    {
+      break;
+    }
+  }
+
+  // Write record (and padding)
+  uint64_t record_start = start;
+  if (total_size != record_size)
+  {
+    WriteHeader(start, 0, cPADDING_FLAG);
+    record_start += total_size - record_size;
+  }
+  WriteHeader(record_start, static_cast<uint32_t>(size), 0);
+  memcpy(data + (record_start & (capacity - 1)) + cHEADER_SIZE, payload, size);
+
+  // Commit - in multi-producer mode, records are committed in the order they were reserved
+  if (multi_producer)
+  {
+    while (write_index.load(std::memory_order_acquire) != start)
+    {
+      std::this_thread::yield(); // preceding producers are still copying their payload
+    }
+  }
+  write_index.store(start + total_size, std::memory_order_release);
+  return true;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
@@ -0,0 +1,202 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/jni/tSharedRingBuffer.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-17
+ *
+ * \brief   Contains tSharedRingBuffer
+ *
+ * \b tSharedRingBuffer
+ *
+ * Lock-free ring buffer in native memory that is shared with Java code
+ * via a direct byte buffer. Producer and consumer exchange records
+ * without any JNI calls.
+ *
+ * Memory layout (all values in native byte order - offsets in bytes):
+ *
+ *   0                        capacity of data area (long)
+ *   cWRITE_INDEX_OFFSET      write index (long): end of committed records - written with release semantics
+ *   cREAD_INDEX_OFFSET       read index (long): end of consumed records - written with release semantics
+ *   cRESERVE_INDEX_OFFSET    reserve index (long): only used by C++ producers in multi-producer mode
+ *   cDATA_OFFSET             data area ('capacity' bytes)
+ *
+ * Indices increase monotonically - their position in the data area is (index & (capacity - 1)).
+ * Each record starts at an 8-byte-aligned position with an 8-byte header:
+ * payload size (int) followed by flags (int). The payload follows and is padded to a multiple of 8 bytes.
+ * Records do not wrap around: if a record does not fit at the end of the data area,
+ * a padding record (cPADDING_FLAG) fills the remaining space.
+ *
+ * Java code must read the index written by the other side with acquire semantics
+ * and write its own index with release semantics (e.g. using
+ * MethodHandles.byteBufferViewVarHandle with getAcquire/setRelease).
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__jni__tSharedRingBuffer_h__
+#define __rrlib__jni__tSharedRingBuffer_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/util/tNoncopyable.h"
+#include <atomic>
+#include <stdint.h>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/jni/jvm.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace jni
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Ring buffer shared with Java
+/*!
+ * Lock-free ring buffer for variable-size records in native memory.
+ * It can be accessed from Java via GetJavaBuffer() (see file documentation for memory layout).
+ *
+ * There may be one consumer (C++ or Java).
+ * In single-producer mode, there may be one producer (C++ or Java).
+ * In multi-producer mode, there may be several C++ producer threads - but no Java producer.
+ */
+class tSharedRingBuffer : private rrlib::util::tNoncopyable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! Offsets in shared memory (see file documentation) */
+  static const size_t cWRITE_INDEX_OFFSET = 64;
+  static const size_t cREAD_INDEX_OFFSET = 128;
+  static const size_t cRESERVE_INDEX_OFFSET = 192;
+  static const size_t cDATA_OFFSET = 256;
+
+  /*! Size of record header in bytes */
+  static const size_t cHEADER_SIZE = 8;
+
+  /*! Flag in record header marking padding record */
+  static const uint32_t cPADDING_FLAG = 1;
+
+  /*!
+   * \param capacity Size of data area in bytes (must be a power of two and at least 64)
+   * \param multi_producer Whether several C++ threads may write concurrently
+   */
+  tSharedRingBuffer(size_t capacity, bool multi_producer = false);
+
+  ~tSharedRingBuffer();
+
+  /*! \return Size of data area in bytes */
+  size_t GetCapacity() const
+  {
+    return capacity;
+  }
+
+  /*!
+   * \param env JNIEnv of current thread
+   * \return Local reference to direct byte buffer covering the whole shared memory (including indices).
+   *         Its byte order is set to native order already (as the layout requires).
+   *         NULL if creating the buffer failed (then, an exception is pending).
+   */
+  jobject GetJavaBuffer(JNIEnv* env = GetEnv()) const;
+
+  /*! \return Maximum payload size of a single record */
+  size_t GetMaxRecordSize() const
+  {
+    return capacity / 2 - cHEADER_SIZE;
+  }
+
+  /*!
+   * Reads next record (consumer only)
+   *
+   * \param buffer Buffer to copy payload to
+   * \param buffer_size Size of buffer
+   * \param record_size Is set to payload size of next record (also if buffer is too small) - 0 if there is no valid record
+   * \return True if record was read. False if buffer is empty or too small (record remains in buffer).
+   *         Also false, if the next record's header is invalid (e.g. size exceeds GetMaxRecordSize() or committed data) -
+   *         such a record is never read.
+   */
+  bool Read(void* buffer, size_t buffer_size, size_t& record_size);
+
+  /*!
+   * Writes record (producer only)
+   *
+   * \param payload Payload of record
+   * \param size Size of payload in bytes (at most GetMaxRecordSize())
+   * \return True if record was written - false if there is not enough free space
+   */
+  bool Write(const void* payload, size_t size);
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Size of data area in bytes */
+  const size_t capacity;
+
+  /*! Whether several C++ threads may write concurrently */
+  const bool multi_producer;
+
+  /*! Shared memory */
+  char* const memory;
+
+  /*! Indices in shared memory */
+  std::atomic<uint64_t>& write_index;
+  std::atomic<uint64_t>& read_index;
+  std::atomic<uint64_t>& reserve_index;
+
+  /*! Data area in shared memory */
+  char* const data;
+
+  /*! Writes record header at specified index */
+  void WriteHeader(uint64_t index, uint32_t size, uint32_t flags)
+  {
+    uint32_t* header = reinterpret_cast<uint32_t*>(data + (index & (capacity - 1)));
+    header[0] = size;
+    header[1] = flags;
+  }
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
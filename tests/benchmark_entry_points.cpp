@@ -0,0 +1,256 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/jni/tests/benchmark_entry_points.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-17
+ *
+ * Microbenchmark for rrlib_jni's entry points - with a Java VM created in-process.
+ * Prints latency percentiles for each operation.
+ *
+ * The JNICalls natives are invoked directly from C++ - so their numbers do not
+ * include the cost of the Java-to-native transition itself.
+ *
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cstring>
+#include <thread>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/jni/type_conversion.h"
+#include "rrlib/jni/tests/benchmark_support.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+using namespace rrlib::jni;
+using namespace rrlib::jni::benchmark;
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+// Natives of org.rrlib.jni.JNICalls (java_native_utility_functions_jni.cpp)
+extern "C"
+{
+  jboolean JNICALL Java_org_rrlib_jni_JNICalls_compareAndSwapLong(JNIEnv* env, jclass class_, jlong ptr, jlong expected, jlong val);
+  jint JNICALL Java_org_rrlib_jni_JNICalls_compareMemory(JNIEnv* env, jclass class_, jlong ptr1, jlong ptr2, jlong length);
+  void JNICALL Java_org_rrlib_jni_JNICalls_copyMemory(JNIEnv* env, jclass class_, jlong dest, jlong src, jlong length);
+  jlong JNICALL Java_org_rrlib_jni_JNICalls_fetchAddLong(JNIEnv* env, jclass class_, jlong ptr, jlong delta);
+  jlong JNICALL Java_org_rrlib_jni_JNICalls_getBufferPointer(JNIEnv* env, jclass class_, jobject buf);
+  jbyte JNICALL Java_org_rrlib_jni_JNICalls_getByte(JNIEnv* env, jclass class_, jlong ptr);
+  void JNICALL Java_org_rrlib_jni_JNICalls_getByteArray(JNIEnv* env, jclass class_, jlong ptr, jbyteArray array, jint offset, jint length);
+  jobject JNICALL Java_org_rrlib_jni_JNICalls_getCByteBuffer(JNIEnv* env, jclass class_, jlong ptr, jint size);
+  jdouble JNICALL Java_org_rrlib_jni_JNICalls_getDouble(JNIEnv* env, jclass class_, jlong ptr);
+  void JNICALL Java_org_rrlib_jni_JNICalls_getDoubleArray(JNIEnv* env, jclass class_, jlong ptr, jdoubleArray array, jint offset, jint length);
+  jfloat JNICALL Java_org_rrlib_jni_JNICalls_getFloat(JNIEnv* env, jclass class_, jlong ptr);
+  void JNICALL Java_org_rrlib_jni_JNICalls_getFloatArray(JNIEnv* env, jclass class_, jlong ptr, jfloatArray array, jint offset, jint length);
+  jint JNICALL Java_org_rrlib_jni_JNICalls_getInt(JNIEnv* env, jclass class_, jlong ptr);
+  void JNICALL Java_org_rrlib_jni_JNICalls_getIntArray(JNIEnv* env, jclass class_, jlong ptr, jintArray array, jint offset, jint length);
+  jlong JNICALL Java_org_rrlib_jni_JNICalls_getJavaVM(JNIEnv* env, jclass class_);
+  jlong JNICALL Java_org_rrlib_jni_JNICalls_getLong(JNIEnv* env, jclass class_, jlong ptr);
+  void JNICALL Java_org_rrlib_jni_JNICalls_getLongArray(JNIEnv* env, jclass class_, jlong ptr, jlongArray array, jint offset, jint length);
+  jlong JNICALL Java_org_rrlib_jni_JNICalls_getPointer(JNIEnv* env, jclass class_, jlong address, jint index);
+  jshort JNICALL Java_org_rrlib_jni_JNICalls_getShort(JNIEnv* env, jclass class_, jlong ptr);
+  void JNICALL Java_org_rrlib_jni_JNICalls_getShortArray(JNIEnv* env, jclass class_, jlong ptr, jshortArray array, jint offset, jint length);
+  jlong JNICALL Java_org_rrlib_jni_JNICalls_loadAcquireLong(JNIEnv* env, jclass class_, jlong ptr);
+  void JNICALL Java_org_rrlib_jni_JNICalls_memcpy(JNIEnv* env, jclass class_, jlong dest, jlong src, jint length);
+  void JNICALL Java_org_rrlib_jni_JNICalls_setByte(JNIEnv* env, jclass class_, jlong ptr, jbyte val);
+  void JNICALL Java_org_rrlib_jni_JNICalls_setByteArray(JNIEnv* env, jclass class_, jlong ptr, jbyteArray array, jint offset, jint length);
+  void JNICALL Java_org_rrlib_jni_JNICalls_setDouble(JNIEnv* env, jclass class_, jlong ptr, jdouble val);
+  void JNICALL Java_org_rrlib_jni_JNICalls_setDoubleArray(JNIEnv* env, jclass class_, jlong ptr, jdoubleArray array, jint offset, jint length);
+  void JNICALL Java_org_rrlib_jni_JNICalls_setFloat(JNIEnv* env, jclass class_, jlong ptr, jfloat val);
+  void JNICALL Java_org_rrlib_jni_JNICalls_setFloatArray(JNIEnv* env, jclass class_, jlong ptr, jfloatArray array, jint offset, jint length);
+  void JNICALL Java_org_rrlib_jni_JNICalls_setInt(JNIEnv* env, jclass class_, jlong ptr, jint val);
+  void JNICALL Java_org_rrlib_jni_JNICalls_setIntArray(JNIEnv* env, jclass class_, jlong ptr, jintArray array, jint offset, jint length);
+  void JNICALL Java_org_rrlib_jni_JNICalls_setLong(JNIEnv* env, jclass class_, jlong ptr, jlong val);
+  void JNICALL Java_org_rrlib_jni_JNICalls_setLongArray(JNIEnv* env, jclass class_, jlong ptr, jlongArray array, jint offset, jint length);
+  void JNICALL Java_org_rrlib_jni_JNICalls_setMemory(JNIEnv* env, jclass class_, jlong dest, jint value, jlong length);
+  void JNICALL Java_org_rrlib_jni_JNICalls_setPointer(JNIEnv* env, jclass class_, jlong arraypointer, jint index, jlong pointer);
+  void JNICALL Java_org_rrlib_jni_JNICalls_setShort(JNIEnv* env, jclass class_, jlong ptr, jshort val);
+  void JNICALL Java_org_rrlib_jni_JNICalls_setShortArray(JNIEnv* env, jclass class_, jlong ptr, jshortArray array, jint offset, jint length);
+  void JNICALL Java_org_rrlib_jni_JNICalls_storeReleaseLong(JNIEnv* env, jclass class_, jlong ptr, jlong val);
+  jint JNICALL Java_org_rrlib_jni_JNICalls_strlen(JNIEnv* env, jclass class_, jlong ptr);
+  jstring JNICALL Java_org_rrlib_jni_JNICalls_toString(JNIEnv* env, jclass class_, jlong pointer);
+}
+
+namespace
+{
+
+/*! Results are written to this variable - so that the compiler cannot remove the operations */
+volatile int64_t sink;
+
+/*! Number of elements in arrays used for array accessors */
+const jint cARRAY_LENGTH = 256;
+
+}
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+void BenchmarkGetEnv()
+{
+  PrintHeader("GetEnv()");
+  Measure("GetEnv() - attached thread", [] { sink = (int64_t)GetEnv(); });
+
+  std::thread native_thread([]
+  {
+    MeasureWithSetup("GetEnv() - unattached thread (attaches)", [] { DetachThread(); }, [] { sink = (int64_t)GetEnv(); });
+    MeasureWithSetup("DetachThread()", [] { GetEnv(); }, [] { DetachThread(); });
+  });
+  native_thread.join();
+}
+
+void BenchmarkJavaWrappers(JNIEnv* env)
+{
+  PrintHeader("tJNIWrappable::GetJavaWrapper()");
+  tLongWrappable* wrappable = NULL;
+  MeasureWithSetup("GetJavaWrapper() - cold (creates wrapper)", [&]
+  {
+    delete wrappable;
+    wrappable = new tLongWrappable();
+  }, [&] { sink = (int64_t)wrappable->GetJavaWrapper(); }, 10000);
+  Measure("GetJavaWrapper() - warm", [&] { sink = (int64_t)wrappable->GetJavaWrapper(); });
+  delete wrappable;
+}
+
+void BenchmarkObjectReferences(JNIEnv* env)
+{
+  PrintHeader("tJavaObjectReference");
+  jclass object_class = env->FindClass("java/lang/Object");
+  jobject object = env->NewObject(object_class, env->GetMethodID(object_class, "<init>", "()V"));
+
+  Measure("NewLocalRef() (included in lines below)", [&] { env->DeleteLocalRef(env->NewLocalRef(object)); });
+  for (int cpp_responsible = 1; cpp_responsible >= 0; cpp_responsible--)
+  {
+    std::string type = cpp_responsible ? "global" : "weak";
+    tJavaObjectReference reference;
+    Measure("Set() - " + type + ", replacing previous", [&] { reference.Set(env->NewLocalRef(object), cpp_responsible); });
+    Measure("Set() + Reset() - " + type, [&] { tJavaObjectReference scoped(env->NewLocalRef(object), cpp_responsible); });
+  }
+  env->DeleteLocalRef(object);
+  env->DeleteLocalRef(object_class);
+}
+
+void BenchmarkStrings(JNIEnv* env)
+{
+  PrintHeader("String conversion");
+  std::string result;
+  for (size_t length : { 8, 64, 512, 4096 })
+  {
+    std::string s(length, 'x');
+    std::string suffix = " - " + std::to_string(length) + " chars";
+    Measure("ToJstring()" + suffix, [&] { env->DeleteLocalRef(ToJstring(s)); });
+    Measure("ToCachedJstring()" + suffix, [&] { env->DeleteLocalRef(ToCachedJstring(s)); });
+    jstring js = ToJstring(s);
+    Measure("ToString()" + suffix, [&] { ToString(js, result); });
+    env->DeleteLocalRef(js);
+  }
+}
+
+void BenchmarkJNICalls(JNIEnv* env)
+{
+  PrintHeader("JNICalls natives (called directly)");
+  static char memory[2][8192] __attribute__((aligned(64)));
+  memset(memory, 1, sizeof(memory));
+  memory[0][sizeof(memory[0]) - 1] = 0;
+  jlong p = (jlong)memory[0];
+  jlong q = (jlong)memory[1];
+  jclass c = NULL;
+
+  Measure("getJavaVM", [&] { sink = Java_org_rrlib_jni_JNICalls_getJavaVM(env, c); });
+  Measure("getByte", [&] { sink = Java_org_rrlib_jni_JNICalls_getByte(env, c, p); });
+  Measure("setByte", [&] { Java_org_rrlib_jni_JNICalls_setByte(env, c, p, 1); });
+  Measure("getShort", [&] { sink = Java_org_rrlib_jni_JNICalls_getShort(env, c, p); });
+  Measure("setShort", [&] { Java_org_rrlib_jni_JNICalls_setShort(env, c, p, 1); });
+  Measure("getInt", [&] { sink = Java_org_rrlib_jni_JNICalls_getInt(env, c, p); });
+  Measure("setInt", [&] { Java_org_rrlib_jni_JNICalls_setInt(env, c, p, 1); });
+  Measure("getLong", [&] { sink = Java_org_rrlib_jni_JNICalls_getLong(env, c, p); });
+  Measure("setLong", [&] { Java_org_rrlib_jni_JNICalls_setLong(env, c, p, 1); });
+  Measure("getFloat", [&] { sink = (int64_t)Java_org_rrlib_jni_JNICalls_getFloat(env, c, p); });
+  Measure("setFloat", [&] { Java_org_rrlib_jni_JNICalls_setFloat(env, c, p, 1.0f); });
+  Measure("getDouble", [&] { sink = (int64_t)Java_org_rrlib_jni_JNICalls_getDouble(env, c, p); });
+  Measure("setDouble", [&] { Java_org_rrlib_jni_JNICalls_setDouble(env, c, p, 1.0); });
+  Measure("getPointer", [&] { sink = Java_org_rrlib_jni_JNICalls_getPointer(env, c, p, 1); });
+  Measure("setPointer", [&] { Java_org_rrlib_jni_JNICalls_setPointer(env, c, p, 1, q); });
+  Measure("loadAcquireLong", [&] { sink = Java_org_rrlib_jni_JNICalls_loadAcquireLong(env, c, p); });
+  Measure("storeReleaseLong", [&] { Java_org_rrlib_jni_JNICalls_storeReleaseLong(env, c, p, 1); });
+  Measure("compareAndSwapLong", [&] { sink = Java_org_rrlib_jni_JNICalls_compareAndSwapLong(env, c, p, 1, 1); });
+  Measure("fetchAddLong", [&] { sink = Java_org_rrlib_jni_JNICalls_fetchAddLong(env, c, p, 0); });
+  memset(memory[0], 1, sizeof(memory[0])); // the rows above wrote 8-byte values to the start of the buffer
+  memory[0][sizeof(memory[0]) - 1] = 0;
+  Measure("strlen (8 KB)", [&] { sink = Java_org_rrlib_jni_JNICalls_strlen(env, c, p); });
+  Measure("toString (8 KB)", [&] { env->DeleteLocalRef(Java_org_rrlib_jni_JNICalls_toString(env, c, p)); });
+  Measure("memcpy (8 KB)", [&] { Java_org_rrlib_jni_JNICalls_memcpy(env, c, q, p, sizeof(memory[0])); });
+  Measure("copyMemory (8 KB)", [&] { Java_org_rrlib_jni_JNICalls_copyMemory(env, c, q, p, sizeof(memory[0])); });
+  Measure("compareMemory (8 KB)", [&] { sink = Java_org_rrlib_jni_JNICalls_compareMemory(env, c, q, p, sizeof(memory[0])); });
+  Measure("setMemory (8 KB)", [&] { Java_org_rrlib_jni_JNICalls_setMemory(env, c, q, 1, sizeof(memory[1])); });
+  Measure("getCByteBuffer", [&] { env->DeleteLocalRef(Java_org_rrlib_jni_JNICalls_getCByteBuffer(env, c, p, 64)); });
+  jobject buffer = Java_org_rrlib_jni_JNICalls_getCByteBuffer(env, c, p, 64);
+  Measure("getBufferPointer", [&] { sink = Java_org_rrlib_jni_JNICalls_getBufferPointer(env, c, buffer); });
+  env->DeleteLocalRef(buffer);
+
+#define RRLIB_JNI_BENCHMARK_ARRAY_ACCESSORS(Type, type) \
+  { \
+    type ## Array array = env->New ## Type ## Array(cARRAY_LENGTH); \
+    Measure("get" #Type "Array (" + std::to_string(cARRAY_LENGTH) + " elements)", [&] { Java_org_rrlib_jni_JNICalls_get ## Type ## Array(env, c, p, array, 0, cARRAY_LENGTH); }); \
+    Measure("set" #Type "Array (" + std::to_string(cARRAY_LENGTH) + " elements)", [&] { Java_org_rrlib_jni_JNICalls_set ## Type ## Array(env, c, p, array, 0, cARRAY_LENGTH); }); \
+    env->DeleteLocalRef(array); \
+  }
+
+  RRLIB_JNI_BENCHMARK_ARRAY_ACCESSORS(Byte, jbyte)
+  RRLIB_JNI_BENCHMARK_ARRAY_ACCESSORS(Short, jshort)
+  RRLIB_JNI_BENCHMARK_ARRAY_ACCESSORS(Int, jint)
+  RRLIB_JNI_BENCHMARK_ARRAY_ACCESSORS(Long, jlong)
+  RRLIB_JNI_BENCHMARK_ARRAY_ACCESSORS(Float, jfloat)
+  RRLIB_JNI_BENCHMARK_ARRAY_ACCESSORS(Double, jdouble)
+
+#undef RRLIB_JNI_BENCHMARK_ARRAY_ACCESSORS
+}
+
+int main(int argc, char** argv)
+{
+  JNIEnv* env = CreateJavaVM();
+  BenchmarkGetEnv();
+  BenchmarkJavaWrappers(env);
+  BenchmarkObjectReferences(env);
+  BenchmarkStrings(env);
+  BenchmarkJNICalls(env);
+  return 0;
+}
@@ -0,0 +1,228 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/jni/tests/benchmark_handle_table.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-17
+ *
+ * Compares the handle table (tJavaObjectHandle) with per-object global references (tJavaObjectReference):
+ *  - Set/Get/Reset latency (single thread)
+ *  - Set/Reset throughput with 1 to 8 threads
+ *  - Duration of a full garbage collection (System.gc()) while many references are held
+ *
+ * For GC details, pass e.g. "-Xlog:gc" via RRLIB_JNI_BENCHMARK_JVM_OPTIONS.
+ *
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/jni/tJavaMethod.h"
+#include "rrlib/jni/tJavaObjectHandle.h"
+#include "rrlib/jni/tJavaObjectReference.h"
+#include "rrlib/jni/tests/benchmark_support.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+using namespace rrlib::jni;
+using namespace rrlib::jni::benchmark;
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+namespace
+{
+
+/*! Triggers full garbage collection */
+const tJavaStaticMethod<void()> system_gc("java/lang/System", "gc");
+
+}
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+/*! Number of Set/Reset operations per thread in throughput benchmark */
+const size_t cOPERATIONS_PER_THREAD = 200000;
+
+/*! Numbers of references held while measuring garbage collection */
+const size_t cHELD_REFERENCES[] = { 0, 100000, 1000000, 4000000 };
+
+/*! Number of garbage collections timed per configuration (median is reported) */
+const size_t cGC_RUNS = 5;
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+/*! \return New local reference to a new java.lang.Object */
+jobject NewJavaObject(JNIEnv* env)
+{
+  static jclass object_class = static_cast<jclass>(env->NewGlobalRef(env->FindClass("java/lang/Object")));
+  static jmethodID constructor = env->GetMethodID(object_class, "<init>", "()V");
+  return env->NewObject(object_class, constructor);
+}
+
+/*! Stores specified object (local reference) in reference - strong in both cases */
+inline void Hold(tJavaObjectReference& reference, jobject java_object, JNIEnv* env)
+{
+  reference.Set(java_object, true);
+}
+inline void Hold(tJavaObjectHandle& handle, jobject java_object, JNIEnv* env)
+{
+  handle.Set(java_object, env);
+}
+
+/*! \return New local reference to object stored in reference */
+inline jobject GetLocal(tJavaObjectReference& reference, JNIEnv* env)
+{
+  return env->NewLocalRef(reference.Get());
+}
+inline jobject GetLocal(tJavaObjectHandle& handle, JNIEnv* env)
+{
+  return handle.Get(env);
+}
+
+/*!
+ * Measures and prints Set/Get/Reset latencies (single thread)
+ *
+ * \tparam TReference tJavaObjectReference or tJavaObjectHandle
+ */
+template <typename TReference>
+void MeasureLatencies(const std::string& name, jobject object, JNIEnv* env)
+{
+  TReference reference;
+  Measure(name + " Set (replacing)", [&] { Hold(reference, env->NewLocalRef(object), env); });
+  Measure(name + " Get", [&] { env->DeleteLocalRef(GetLocal(reference, env)); });
+  Measure(name + " Set + Reset", [&] { TReference temporary; Hold(temporary, env->NewLocalRef(object), env); });
+}
+
+/*!
+ * Measures Set/Reset throughput with specified number of threads (each with its own references)
+ *
+ * \tparam TReference tJavaObjectReference or tJavaObjectHandle
+ * \return Operations per second
+ */
+template <typename TReference>
+double MeasureThroughput(size_t thread_count, jobject object)
+{
+  std::atomic<size_t> ready_threads(0);
+  std::atomic<bool> start(false);
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < thread_count; t++)
+  {
+    threads.emplace_back([&]
+    {
+      JNIEnv* env = GetEnv(); // attach before measurement
+      ready_threads++;
+      while (!start.load(std::memory_order_acquire))
+      {}
+      for (size_t i = 0; i < cOPERATIONS_PER_THREAD; i++)
+      {
+        TReference reference;
+        Hold(reference, env->NewLocalRef(object), env);
+      }
+      DetachThread();
+    });
+  }
+  while (ready_threads.load() < thread_count)
+  {
+    std::this_thread::yield();
+  }
+  int64_t start_time = Now();
+  start.store(true, std::memory_order_release);
+  for (std::thread & thread : threads)
+  {
+    thread.join();
+  }
+  return (thread_count * cOPERATIONS_PER_THREAD) / ((Now() - start_time) / 1e9);
+}
+
+/*!
+ * Measures duration of System.gc() while specified number of objects is referenced
+ *
+ * \tparam TReference tJavaObjectReference or tJavaObjectHandle
+ * \return Median duration in milliseconds
+ */
+template <typename TReference>
+double MeasureGarbageCollection(size_t held_references, JNIEnv* env)
+{
+  std::unique_ptr<TReference[]> references(new TReference[held_references]);
+  for (size_t i = 0; i < held_references; i++)
+  {
+    Hold(references[i], NewJavaObject(env), env);
+  }
+  system_gc(); // move objects to old generation
+  std::vector<double> durations;
+  for (size_t i = 0; i < cGC_RUNS; i++)
+  {
+    int64_t start = Now();
+    system_gc();
+    durations.push_back((Now() - start) / 1e6);
+  }
+  return Evaluate(durations).p50;
+}
+
+int main(int argc, char** argv)
+{
+  JNIEnv* env = CreateJavaVM();
+  jobject object = env->NewGlobalRef(NewJavaObject(env));
+
+  PrintHeader("Single thread");
+  MeasureLatencies<tJavaObjectReference>("tJavaObjectReference", object, env);
+  MeasureLatencies<tJavaObjectHandle>("tJavaObjectHandle", object, env);
+  printf("(Get creates and deletes a local reference in both cases - as tJavaObjectHandle::Get returns a new one)\n");
+
+  printf("\nSet/Reset throughput\n%-8s %24s %24s\n", "threads", "tJavaObjectReference/s", "tJavaObjectHandle/s");
+  for (size_t thread_count = 1; thread_count <= 8; thread_count *= 2)
+  {
+    double reference_throughput = MeasureThroughput<tJavaObjectReference>(thread_count, object);
+    double handle_throughput = MeasureThroughput<tJavaObjectHandle>(thread_count, object);
+    printf("%-8zu %24.0f %24.0f\n", thread_count, reference_throughput, handle_throughput);
+  }
+
+  printf("\nSystem.gc() duration (median of %zu)\n%-20s %24s %24s\n", cGC_RUNS, "held references", "tJavaObjectReference ms", "tJavaObjectHandle ms");
+  for (size_t held_references : cHELD_REFERENCES)
+  {
+    double reference_duration = MeasureGarbageCollection<tJavaObjectReference>(held_references, env);
+    double handle_duration = MeasureGarbageCollection<tJavaObjectHandle>(held_references, env);
+    printf("%-20zu %24.2f %24.2f\n", held_references, reference_duration, handle_duration);
+  }
+  return 0;
+}
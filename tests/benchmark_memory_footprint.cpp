@@ -0,0 +1,153 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/jni/tests/benchmark_memory_footprint.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-17
+ *
+ * Memory footprint benchmark for tJavaObjectReference and tJNIWrappable.
+ * Prints object sizes, resident memory per native object and
+ * memory per Java wrapper (resident memory and used Java heap).
+ *
+ * Build library and benchmark with and without RRLIB_JNI_COMPACT_OBJECT_REFERENCE
+ * to compare both layouts.
+ *
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <fstream>
+#include <unistd.h>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/jni/tJNIWrappable.h"
+#include "rrlib/jni/tJavaMethod.h"
+#include "rrlib/jni/tJavaObjectHandle.h"
+#include "rrlib/jni/tests/benchmark_support.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+using namespace rrlib::jni;
+using namespace rrlib::jni::benchmark;
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+namespace
+{
+
+/*! Java methods for querying used Java heap */
+const tJavaStaticMethod<void()> system_gc("java/lang/System", "gc");
+const tJavaStaticMethod<jobject()> get_runtime("java/lang/Runtime", "getRuntime", "()Ljava/lang/Runtime;");
+const tJavaMethod<jlong()> total_memory("java/lang/Runtime", "totalMemory");
+const tJavaMethod<jlong()> free_memory("java/lang/Runtime", "freeMemory");
+
+}
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+/*! Number of native objects allocated */
+const size_t cNATIVE_OBJECTS = 1000000;
+
+/*! Number of Java wrappers created */
+const size_t cJAVA_WRAPPERS = 100000;
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+/*! \return Resident memory of this process in bytes */
+size_t GetResidentMemory()
+{
+  size_t total_pages = 0, resident_pages = 0;
+  std::ifstream statm("/proc/self/statm");
+  statm >> total_pages >> resident_pages;
+  return resident_pages * sysconf(_SC_PAGESIZE);
+}
+
+/*! \return Used Java heap in bytes (after garbage collection) */
+int64_t GetUsedJavaHeap()
+{
+  system_gc();
+  jobject runtime = get_runtime();
+  int64_t result = total_memory(runtime) - free_memory(runtime);
+  GetEnv()->DeleteLocalRef(runtime);
+  return result;
+}
+
+int main(int argc, char** argv)
+{
+#ifdef RRLIB_JNI_COMPACT_OBJECT_REFERENCE
+  printf("Layout: compact (RRLIB_JNI_COMPACT_OBJECT_REFERENCE)\n\n");
+#else
+  printf("Layout: default\n\n");
+#endif
+  printf("%-40s %8zu bytes\n", "sizeof(tJavaObjectReference)", sizeof(tJavaObjectReference));
+  printf("%-40s %8zu bytes\n", "sizeof(tJavaObjectHandle)", sizeof(tJavaObjectHandle));
+  printf("%-40s %8zu bytes\n", "sizeof(tJNIWrappable)", sizeof(tJNIWrappable));
+
+  // Native objects (no Java VM required)
+  std::vector<tLongWrappable*> objects;
+  objects.reserve(cNATIVE_OBJECTS);
+  size_t resident_before = GetResidentMemory();
+  for (size_t i = 0; i < cNATIVE_OBJECTS; i++)
+  {
+    objects.push_back(new tLongWrappable());
+  }
+  size_t resident_after = GetResidentMemory();
+  printf("%-40s %8.1f bytes\n", "resident memory per tJNIWrappable", static_cast<double>(resident_after - resident_before) / cNATIVE_OBJECTS);
+
+  // Java wrappers
+  CreateJavaVM();
+  objects[0]->GetJavaWrapper(); // class lookup
+  int64_t heap_before = GetUsedJavaHeap();
+  resident_before = GetResidentMemory();
+  for (size_t i = 1; i <= cJAVA_WRAPPERS; i++)
+  {
+    objects[i]->GetJavaWrapper();
+  }
+  resident_after = GetResidentMemory();
+  int64_t heap_after = GetUsedJavaHeap();
+  printf("%-40s %8.1f bytes\n", "resident memory per Java wrapper", static_cast<double>(resident_after - resident_before) / cJAVA_WRAPPERS);
+  printf("%-40s %8.1f bytes\n", "used Java heap per Java wrapper", static_cast<double>(heap_after - heap_before) / cJAVA_WRAPPERS);
+
+  for (tLongWrappable * object : objects)
+  {
+    delete object;
+  }
+  return 0;
+}
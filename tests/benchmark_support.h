@@ -0,0 +1,225 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/jni/tests/benchmark_support.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-17
+ *
+ * Helpers for rrlib_jni benchmark programs:
+ * Creating a Java VM in-process (JNI_CreateJavaVM) and measuring latency percentiles of operations.
+ *
+ * JVM options can be passed via the environment variable RRLIB_JNI_BENCHMARK_JVM_OPTIONS
+ * (separated by spaces - e.g. "-Xmx2g -Xlog:gc").
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__jni__tests__benchmark_support_h__
+#define __rrlib__jni__tests__benchmark_support_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/jni/tJNIWrappable.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace jni
+{
+namespace benchmark
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+/*!
+ * Wrappable whose Java wrapper is a java.lang.Long (has a constructor taking long).
+ * Allows benchmarking wrapper creation without any Java sources.
+ */
+class tLongWrappable : public tJNIWrappable
+{
+protected:
+  virtual const char* GetJavaClassName() const override
+  {
+    return "java/lang/Long";
+  }
+};
+
+/*! Latency statistics of an operation (in nanoseconds per operation) */
+struct tLatencies
+{
+  double p50, p90, p99, max;
+};
+
+//----------------------------------------------------------------------
+// Function declarations
+//----------------------------------------------------------------------
+
+/*! \return Current time of steady clock in nanoseconds */
+inline int64_t Now()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/*!
+ * Creates Java VM in this process and sets it as rrlib_jni's Java VM.
+ * Terminates program if Java VM cannot be created.
+ *
+ * \return JNIEnv of current thread
+ */
+inline JNIEnv* CreateJavaVM()
+{
+  std::vector<std::string> option_strings;
+  const char* options_variable = getenv("RRLIB_JNI_BENCHMARK_JVM_OPTIONS");
+  std::istringstream option_stream(options_variable ? options_variable : "");
+  std::string option;
+  while (option_stream >> option)
+  {
+    option_strings.push_back(option);
+  }
+  std::vector<JavaVMOption> options(option_strings.size());
+  for (size_t i = 0; i < option_strings.size(); i++)
+  {
+    options[i].optionString = const_cast<char*>(option_strings[i].c_str());
+    options[i].extraInfo = NULL;
+  }
+
+  JavaVMInitArgs arguments;
+  arguments.version = JNI_VERSION_1_6;
+  arguments.nOptions = static_cast<jint>(options.size());
+  arguments.options = options.empty() ? NULL : &options[0];
+  arguments.ignoreUnrecognized = JNI_FALSE;
+
+  JavaVM* jvm = NULL;
+  JNIEnv* env = NULL;
+  if (JNI_CreateJavaVM(&jvm, (void**)&env, &arguments) != JNI_OK)
+  {
+    fprintf(stderr, "Could not create Java VM\n");
+    exit(EXIT_FAILURE);
+  }
+  SetJavaVM(jvm);
+  return env;
+}
+
+/*! \return Latency statistics of the specified samples (nanoseconds per operation - sorted by this function) */
+inline tLatencies Evaluate(std::vector<double>& samples)
+{
+  std::sort(samples.begin(), samples.end());
+  tLatencies result;
+  result.p50 = samples[samples.size() * 50 / 100];
+  result.p90 = samples[samples.size() * 90 / 100];
+  result.p99 = samples[samples.size() * 99 / 100];
+  result.max = samples.back();
+  return result;
+}
+
+/*! Prints header for lines printed by Print() */
+inline void PrintHeader(const char* title)
+{
+  printf("\n%s\n%-48s %10s %10s %10s %12s\n", title, "operation (ns/op)", "p50", "p90", "p99", "max");
+}
+
+/*! Prints latency statistics of operation */
+inline void Print(const std::string& name, const tLatencies& latencies)
+{
+  printf("%-48s %10.1f %10.1f %10.1f %12.1f\n", name.c_str(), latencies.p50, latencies.p90, latencies.p99, latencies.max);
+}
+
+/*!
+ * Measures and prints latency percentiles of operation.
+ * Each sample times a batch of operations (so that fast operations are not dominated by clock overhead).
+ *
+ * \param name Name of operation
+ * \param operation Operation to measure (functor without arguments)
+ * \param samples Number of samples
+ * \param operations_per_sample Number of operations timed per sample
+ */
+template <typename TOperation>
+tLatencies Measure(const std::string& name, TOperation operation, size_t samples = 10000, size_t operations_per_sample = 16)
+{
+  for (size_t i = 0; i < samples * operations_per_sample / 10; i++) // warm-up
+  {
+    operation();
+  }
+  std::vector<double> sample_latencies(samples);
+  for (size_t i = 0; i < samples; i++)
+  {
+    int64_t start = Now();
+    for (size_t j = 0; j < operations_per_sample; j++)
+    {
+      operation();
+    }
+    sample_latencies[i] = static_cast<double>(Now() - start) / operations_per_sample;
+  }
+  tLatencies result = Evaluate(sample_latencies);
+  Print(name, result);
+  return result;
+}
+
+/*!
+ * Measures and prints latency percentiles of operation that requires (untimed) preparation before each execution
+ *
+ * \param name Name of operation
+ * \param setup Preparation before each operation (functor without arguments - not timed)
+ * \param operation Operation to measure (functor without arguments)
+ * \param samples Number of samples (one operation each)
+ */
+template <typename TSetup, typename TOperation>
+tLatencies MeasureWithSetup(const std::string& name, TSetup setup, TOperation operation, size_t samples = 1000)
+{
+  std::vector<double> sample_latencies(samples);
+  for (size_t i = 0; i < samples; i++)
+  {
+    setup();
+    int64_t start = Now();
+    operation();
+    sample_latencies[i] = static_cast<double>(Now() - start);
+  }
+  tLatencies result = Evaluate(sample_latencies);
+  Print(name, result);
+  return result;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+
+#endif
@@ -0,0 +1,156 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/jni/tests/benchmark_wrapper_creation.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-17
+ *
+ * Contention benchmark for Java wrapper creation (tJNIWrappable::GetJavaWrapper).
+ * 1 to 32 threads concurrently create wrappers for distinct objects.
+ * Prints throughput and speedup compared to a single thread.
+ *
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <atomic>
+#include <thread>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/jni/tJNIWrappable.h"
+#include "rrlib/jni/tests/benchmark_support.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+using namespace rrlib::jni;
+using namespace rrlib::jni::benchmark;
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+/*! Number of wrappers created by each thread per run */
+const size_t cWRAPPERS_PER_THREAD = 20000;
+
+/*! Number of runs per thread count (best run is reported) */
+const size_t cRUNS = 5;
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+/*!
+ * Creates wrappers with specified number of threads
+ *
+ * \return Duration of wrapper creation in nanoseconds (from start signal until last thread is done)
+ */
+int64_t Run(size_t thread_count)
+{
+  std::vector<std::vector<tLongWrappable*>> objects(thread_count);
+  for (auto & thread_objects : objects)
+  {
+    for (size_t i = 0; i < cWRAPPERS_PER_THREAD; i++)
+    {
+      thread_objects.push_back(new tLongWrappable());
+    }
+  }
+
+  std::atomic<size_t> ready_threads(0);
+  std::atomic<bool> start(false);
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < thread_count; t++)
+  {
+    threads.emplace_back([&, t]
+    {
+      GetEnv(); // attach before measurement
+      ready_threads++;
+      while (!start.load(std::memory_order_acquire))
+      {}
+      for (tLongWrappable * object : objects[t])
+      {
+        object->GetJavaWrapper();
+      }
+      DetachThread();
+    });
+  }
+  while (ready_threads.load() < thread_count)
+  {
+    std::this_thread::yield();
+  }
+  int64_t start_time = Now();
+  start.store(true, std::memory_order_release);
+  for (std::thread & thread : threads)
+  {
+    thread.join();
+  }
+  int64_t duration = Now() - start_time;
+
+  for (auto & thread_objects : objects)
+  {
+    for (tLongWrappable * object : thread_objects)
+    {
+      delete object;
+    }
+  }
+  return duration;
+}
+
+int main(int argc, char** argv)
+{
+  CreateJavaVM();
+  Run(1); // warm-up (class lookup, JIT)
+
+  printf("%-8s %16s %10s\n", "threads", "wrappers/s", "speedup");
+  double single_thread_throughput = 0;
+  for (size_t thread_count = 1; thread_count <= 32; thread_count *= 2)
+  {
+    int64_t best_duration = 0;
+    for (size_t run = 0; run < cRUNS; run++)
+    {
+      int64_t duration = Run(thread_count);
+      best_duration = (run == 0 || duration < best_duration) ? duration : best_duration;
+    }
+    double throughput = (thread_count * cWRAPPERS_PER_THREAD) / (best_duration / 1e9);
+    if (thread_count == 1)
+    {
+      single_thread_throughput = throughput;
+    }
+    printf("%-8zu %16.0f %10.2f\n", thread_count, throughput, throughput / single_thread_throughput);
+  }
+  return 0;
+}
@@ -36,12 +36,16 @@
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
 #include <jni.h>
+#include <cstring>
+#include <string>
 
 //----------------------------------------------------------------------
 // Internal includes with ""
 //----------------------------------------------------------------------
 #include "rrlib/jni/jvm.h"
+#include "rrlib/jni/tArrayView.h"
 #include "rrlib/jni/tJNIWrappable.h"
+#include "rrlib/jni/tJavaStringCache.h"
 
 //----------------------------------------------------------------------
 // Namespace declaration
@@ -123,6 +127,7 @@ inline jdouble ToJdouble(T v)
 inline jstring ToJstring(const char* c)
 {
   jstring js = GetEnv()->NewStringUTF(c);
+  RRLIB_JNI_COUNT(STRING_TO_JAVA);
   return js;
 }
 inline jstring ToJstring(const std::string& d)
@@ -130,6 +135,41 @@ inline jstring ToJstring(const std::string& d)
   return ToJstring(d.c_str());
 }
 
+/*!
+ * Like ToJstring - but returns cached Java string if the same content was converted before
+ * (see tJavaStringCache). Intended for strings that are converted frequently (e.g. names or units).
+ */
+inline jstring ToCachedJstring(const char* s, size_t length)
+{
+  RRLIB_JNI_COUNT(STRING_TO_JAVA);
+  return tJavaStringCache::GetDefaultInstance().Get(s, length);
+}
+inline jstring ToCachedJstring(const char* s)
+{
+  return ToCachedJstring(s, strlen(s));
+}
+inline jstring ToCachedJstring(const std::string& s)
+{
+  return ToCachedJstring(s.data(), s.length());
+}
+
+/*!
+ * \param v Vector with elements to copy
+ * \return Java primitive array with copy of elements (NULL if OutOfMemoryError is pending)
+ */
+template <typename T>
+inline typename internal::tPrimitiveArrayTraits<T>::tArray ToJarray(const std::vector<T>& v)
+{
+  typedef internal::tPrimitiveArrayTraits<T> tTraits;
+  JNIEnv* env = GetEnv();
+  typename tTraits::tArray array = tTraits::New(env, static_cast<jsize>(v.size()));
+  if (array != NULL && v.size() > 0)
+  {
+    tTraits::SetRegion(env, array, 0, static_cast<jsize>(v.size()), &v[0]);
+  }
+  return array;
+}
+
 //inline jobject ToJobject(tJNIWrappable* ptr)
 //{
 //  return ptr->GetJavaWrapper();
@@ -226,15 +266,70 @@ inline float ToFloat(jfloat v)
   return static_cast<jfloat>(v);
 }
 
+/*!
+ * Copies (modified UTF-8) content of Java string to provided buffer - without any heap allocation.
+ *
+ * \param js Java string
+ * \param buffer Buffer to copy null-terminated string to
+ * \param buffer_size Size of buffer in bytes
+ * \return Length of string in bytes (without terminator). If this is >= buffer_size, buffer was too small and is not modified.
+ */
+inline size_t ToString(jstring js, char* buffer, size_t buffer_size)
+{
+  JNIEnv* env = GetEnv();
+  size_t utf_length = static_cast<size_t>(env->GetStringUTFLength(js));
+  RRLIB_JNI_COUNT(STRING_FROM_JAVA);
+  if (utf_length < buffer_size)
+  {
+    env->GetStringUTFRegion(js, 0, env->GetStringLength(js), buffer);
+    buffer[utf_length] = 0;
+  }
+  return utf_length;
+}
+
+/*!
+ * Copies (modified UTF-8) content of Java string to existing std::string.
+ * Capacity of 'result' is reused - so there is no heap allocation if it is large enough.
+ *
+ * \param js Java string
+ * \param result String to copy content to
+ */
+inline void ToString(jstring js, std::string& result)
+{
+  JNIEnv* env = GetEnv();
+  jsize utf_length = env->GetStringUTFLength(js);
+  RRLIB_JNI_COUNT(STRING_FROM_JAVA);
+  result.resize(utf_length);
+  if (utf_length > 0)
+  {
+    env->GetStringUTFRegion(js, 0, env->GetStringLength(js), &result[0]);  // terminator (if written) goes to std::string's reserved terminator position
+  }
+}
+
 inline std::string ToString(jstring js)
 {
-  const char* str = GetEnv()->GetStringUTFChars(js, NULL);
-  assert(str != NULL && "OutOfMemoryError");
-  std::string s(str);
-  GetEnv()->ReleaseStringUTFChars(js, str);
+  std::string s;
+  ToString(js, s);
   return s;
 }
 
+/*!
+ * \param array Java primitive array
+ * \return Vector with copy of array elements
+ */
+template <typename TArray>
+inline std::vector<typename internal::tPrimitiveArrayElement<TArray>::type> ToVector(TArray array)
+{
+  typedef typename internal::tPrimitiveArrayElement<TArray>::type tElement;
+  JNIEnv* env = GetEnv();
+  std::vector<tElement> result(env->GetArrayLength(array));
+  if (result.size() > 0)
+  {
+    internal::tPrimitiveArrayTraits<tElement>::GetRegion(env, array, 0, static_cast<jsize>(result.size()), &result[0]);
+  }
+  return result;
+}
+
 template <typename T>
 inline T* StaticCast(jlong ptr)
 {
@@ -0,0 +1,287 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/jni/type_traits.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-17
+ *
+ * Type traits for C++ types that can be passed to and from Java:
+ * JNI type signatures (generated at compile time), conversion to/from
+ * JNI types and dispatch to the type-specific JNI call and field functions.
+ *
+ * Supported types are the JNI primitive types, bool, JNI reference types
+ * (jobject, jstring, jclass and arrays) and std::string (converted to/from java.lang.String).
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__jni__type_traits_h__
+#define __rrlib__jni__type_traits_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <jni.h>
+#include <string>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/jni/type_conversion.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace jni
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+namespace internal
+{
+
+/*! Compile-time string */
+template <char ... CHARACTERS>
+struct tCharSequence
+{
+  static constexpr char value[sizeof...(CHARACTERS) + 1] = { CHARACTERS..., 0 };
+};
+
+template <char ... CHARACTERS>
+constexpr char tCharSequence<CHARACTERS...>::value[];
+
+/*! Concatenates compile-time strings (tCharSequence) */
+template <typename ... TSequences>
+struct tConcat;
+
+template <>
+struct tConcat<>
+{
+  typedef tCharSequence<> type;
+};
+
+template <char ... A>
+struct tConcat<tCharSequence<A...>>
+{
+  typedef tCharSequence<A...> type;
+};
+
+template <char ... A, char ... B, typename ... TRest>
+struct tConcat<tCharSequence<A...>, tCharSequence<B...>, TRest...>
+{
+  typedef typename tConcat<tCharSequence<A..., B...>, TRest...>::type type;
+};
+
+typedef tCharSequence<'L', 'j', 'a', 'v', 'a', '/', 'l', 'a', 'n', 'g', '/', 'O', 'b', 'j', 'e', 'c', 't', ';'> tObjectSignature;
+typedef tCharSequence<'L', 'j', 'a', 'v', 'a', '/', 'l', 'a', 'n', 'g', '/', 'S', 't', 'r', 'i', 'n', 'g', ';'> tStringSignature;
+typedef tCharSequence<'L', 'j', 'a', 'v', 'a', '/', 'l', 'a', 'n', 'g', '/', 'C', 'l', 'a', 's', 's', ';'> tClassSignature;
+
+/*! Traits for JNI primitive types - dispatches to the type-specific JNI functions */
+#define RRLIB_JNI_PRIMITIVE_TYPE_TRAITS(type, signature, member, name) \
+  struct tJNI ## name ## Traits \
+  { \
+    typedef type tJNI; \
+    typedef tCharSequence<signature> tSignature; \
+    static jvalue ToJvalue(type v) { jvalue result; result.member = v; return result; } \
+    static type Call(JNIEnv* env, jobject object, jmethodID method, const jvalue* arguments) { return env->Call ## name ## MethodA(object, method, arguments); } \
+    static type CallStatic(JNIEnv* env, jclass clazz, jmethodID method, const jvalue* arguments) { return env->CallStatic ## name ## MethodA(clazz, method, arguments); } \
+    static type GetField(JNIEnv* env, jobject object, jfieldID field) { return env->Get ## name ## Field(object, field); } \
+    static void SetField(JNIEnv* env, jobject object, jfieldID field, type value) { env->Set ## name ## Field(object, field, value); } \
+    static type GetStaticField(JNIEnv* env, jclass clazz, jfieldID field) { return env->GetStatic ## name ## Field(clazz, field); } \
+    static void SetStaticField(JNIEnv* env, jclass clazz, jfieldID field, type value) { env->SetStatic ## name ## Field(clazz, field, value); } \
+  };
+
+RRLIB_JNI_PRIMITIVE_TYPE_TRAITS(jboolean, 'Z', z, Boolean)
+RRLIB_JNI_PRIMITIVE_TYPE_TRAITS(jbyte, 'B', b, Byte)
+RRLIB_JNI_PRIMITIVE_TYPE_TRAITS(jchar, 'C', c, Char)
+RRLIB_JNI_PRIMITIVE_TYPE_TRAITS(jshort, 'S', s, Short)
+RRLIB_JNI_PRIMITIVE_TYPE_TRAITS(jint, 'I', i, Int)
+RRLIB_JNI_PRIMITIVE_TYPE_TRAITS(jlong, 'J', j, Long)
+RRLIB_JNI_PRIMITIVE_TYPE_TRAITS(jfloat, 'F', f, Float)
+RRLIB_JNI_PRIMITIVE_TYPE_TRAITS(jdouble, 'D', d, Double)
+
+#undef RRLIB_JNI_PRIMITIVE_TYPE_TRAITS
+
+/*! Traits for JNI reference types - dispatches to the JNI functions for objects */
+template <typename TReference, typename TSignature>
+struct tJNIReferenceTraits
+{
+  typedef TReference tJNI;
+  typedef TSignature tSignature;
+  static jvalue ToJvalue(TReference v)
+  {
+    jvalue result;
+    result.l = v;
+    return result;
+  }
+  static TReference Call(JNIEnv* env, jobject object, jmethodID method, const jvalue* arguments)
+  {
+    return static_cast<TReference>(env->CallObjectMethodA(object, method, arguments));
+  }
+  static TReference CallStatic(JNIEnv* env, jclass clazz, jmethodID method, const jvalue* arguments)
+  {
+    return static_cast<TReference>(env->CallStaticObjectMethodA(clazz, method, arguments));
+  }
+  static TReference GetField(JNIEnv* env, jobject object, jfieldID field)
+  {
+    return static_cast<TReference>(env->GetObjectField(object, field));
+  }
+  static void SetField(JNIEnv* env, jobject object, jfieldID field, TReference value)
+  {
+    env->SetObjectField(object, field, value);
+  }
+  static TReference GetStaticField(JNIEnv* env, jclass clazz, jfieldID field)
+  {
+    return static_cast<TReference>(env->GetStaticObjectField(clazz, field));
+  }
+  static void SetStaticField(JNIEnv* env, jclass clazz, jfieldID field, TReference value)
+  {
+    env->SetStaticObjectField(clazz, field, value);
+  }
+};
+
+/*! Traits for C++ types whose JNI representation has the same type (no conversion required) */
+template <typename TTraits>
+struct tIdentityTypeTraits : TTraits
+{
+  typedef typename TTraits::tJNI tJNI;
+  static tJNI ToJNI(JNIEnv* env, tJNI v)
+  {
+    return v;
+  }
+  static tJNI FromJNI(JNIEnv* env, tJNI v)
+  {
+    return v;
+  }
+  static void ReleaseJNI(JNIEnv* env, const jvalue& v)
+  {}
+};
+
+}
+
+/*!
+ * Traits for C++ type T that can be passed to and from Java.
+ *
+ * tJNI:       JNI type that T is represented by
+ * tSignature: JNI type signature (tCharSequence)
+ * ToJNI:      Converts C++ value to JNI value
+ * FromJNI:    Converts JNI value (returned by JNI function) to C++ value - releasing any local reference
+ * ReleaseJNI: Releases JNI value created by ToJNI (passed as jvalue)
+ * Call..., Get/Set...Field: type-specific JNI functions
+ */
+template <typename T>
+struct tJNIType;
+
+template <> struct tJNIType<jboolean> : internal::tIdentityTypeTraits<internal::tJNIBooleanTraits> {};
+template <> struct tJNIType<jbyte> : internal::tIdentityTypeTraits<internal::tJNIByteTraits> {};
+template <> struct tJNIType<jchar> : internal::tIdentityTypeTraits<internal::tJNICharTraits> {};
+template <> struct tJNIType<jshort> : internal::tIdentityTypeTraits<internal::tJNIShortTraits> {};
+template <> struct tJNIType<jint> : internal::tIdentityTypeTraits<internal::tJNIIntTraits> {};
+template <> struct tJNIType<jlong> : internal::tIdentityTypeTraits<internal::tJNILongTraits> {};
+template <> struct tJNIType<jfloat> : internal::tIdentityTypeTraits<internal::tJNIFloatTraits> {};
+template <> struct tJNIType<jdouble> : internal::tIdentityTypeTraits<internal::tJNIDoubleTraits> {};
+
+template <> struct tJNIType<jobject> : internal::tIdentityTypeTraits<internal::tJNIReferenceTraits<jobject, internal::tObjectSignature>> {};
+template <> struct tJNIType<jstring> : internal::tIdentityTypeTraits<internal::tJNIReferenceTraits<jstring, internal::tStringSignature>> {};
+template <> struct tJNIType<jclass> : internal::tIdentityTypeTraits<internal::tJNIReferenceTraits<jclass, internal::tClassSignature>> {};
+template <> struct tJNIType<jobjectArray> : internal::tIdentityTypeTraits<internal::tJNIReferenceTraits<jobjectArray, internal::tConcat<internal::tCharSequence<'['>, internal::tObjectSignature>::type>> {};
+template <> struct tJNIType<jbooleanArray> : internal::tIdentityTypeTraits<internal::tJNIReferenceTraits<jbooleanArray, internal::tCharSequence<'[', 'Z'>>> {};
+template <> struct tJNIType<jbyteArray> : internal::tIdentityTypeTraits<internal::tJNIReferenceTraits<jbyteArray, internal::tCharSequence<'[', 'B'>>> {};
+template <> struct tJNIType<jcharArray> : internal::tIdentityTypeTraits<internal::tJNIReferenceTraits<jcharArray, internal::tCharSequence<'[', 'C'>>> {};
+template <> struct tJNIType<jshortArray> : internal::tIdentityTypeTraits<internal::tJNIReferenceTraits<jshortArray, internal::tCharSequence<'[', 'S'>>> {};
+template <> struct tJNIType<jintArray> : internal::tIdentityTypeTraits<internal::tJNIReferenceTraits<jintArray, internal::tCharSequence<'[', 'I'>>> {};
+template <> struct tJNIType<jlongArray> : internal::tIdentityTypeTraits<internal::tJNIReferenceTraits<jlongArray, internal::tCharSequence<'[', 'J'>>> {};
+template <> struct tJNIType<jfloatArray> : internal::tIdentityTypeTraits<internal::tJNIReferenceTraits<jfloatArray, internal::tCharSequence<'[', 'F'>>> {};
+template <> struct tJNIType<jdoubleArray> : internal::tIdentityTypeTraits<internal::tJNIReferenceTraits<jdoubleArray, internal::tCharSequence<'[', 'D'>>> {};
+
+template <>
+struct tJNIType<bool> : internal::tJNIBooleanTraits
+{
+  static jboolean ToJNI(JNIEnv* env, bool v)
+  {
+    return v ? JNI_TRUE : JNI_FALSE;
+  }
+  static bool FromJNI(JNIEnv* env, jboolean v)
+  {
+    return v != JNI_FALSE;
+  }
+  static void ReleaseJNI(JNIEnv* env, const jvalue& v)
+  {}
+};
+
+template <>
+struct tJNIType<std::string> : internal::tJNIReferenceTraits<jstring, internal::tStringSignature>
+{
+  static jstring ToJNI(JNIEnv* env, const std::string& v)
+  {
+    return ToJstring(v);
+  }
+  static std::string FromJNI(JNIEnv* env, jstring v)
+  {
+    if (v == NULL)
+    {
+      return std::string();
+    }
+    std::string result = ToString(v);
+    env->DeleteLocalRef(v);
+    return result;
+  }
+  static void ReleaseJNI(JNIEnv* env, const jvalue& v)
+  {
+    env->DeleteLocalRef(v.l);
+  }
+};
+
+template <>
+struct tJNIType<void>
+{
+  typedef void tJNI;
+  typedef internal::tCharSequence<'V'> tSignature;
+  static void Call(JNIEnv* env, jobject object, jmethodID method, const jvalue* arguments)
+  {
+    env->CallVoidMethodA(object, method, arguments);
+  }
+  static void CallStatic(JNIEnv* env, jclass clazz, jmethodID method, const jvalue* arguments)
+  {
+    env->CallStaticVoidMethodA(clazz, method, arguments);
+  }
+};
+
+/*! Type signature of Java method with return type R and parameter types TArgs (e.g. "(ILjava/lang/String;)V") */
+template <typename R, typename ... TArgs>
+struct tMethodSignature
+{
+  typedef typename internal::tConcat < internal::tCharSequence<'('>, typename tJNIType<TArgs>::tSignature..., internal::tCharSequence<')'>, typename tJNIType<R>::tSignature >::type type;
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif